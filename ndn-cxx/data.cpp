@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/encoding-arena.hpp"
 #include "ndn-cxx/util/sha256.hpp"
 
 namespace ndn {
@@ -111,13 +112,10 @@ Data::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
+  EncodingArena arena;
+  wireEncode(arena.encoder());
 
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  const_cast<Data*>(this)->wireDecode(buffer.block());
+  const_cast<Data*>(this)->wireDecode(arena.block());
   return m_wire;
 }
 
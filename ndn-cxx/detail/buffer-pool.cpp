@@ -0,0 +1,75 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/buffer-pool.hpp"
+#include "ndn-cxx/encoding/tlv.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace ndn {
+namespace detail {
+
+constexpr size_t BufferPool::MAX_POOLED_SIZE;
+constexpr size_t BufferPool::MAX_POOLED_BUFFERS;
+
+static_assert(BufferPool::MAX_POOLED_SIZE == MAX_NDN_PACKET_SIZE,
+              "the largest size class must hold a whole packet");
+
+// Small elements, typical Ethernet-sized packets, and the largest NDN packets
+static const size_t SIZE_CLASSES[] = {128, 512, 2048, BufferPool::MAX_POOLED_SIZE};
+static constexpr size_t N_SIZE_CLASSES = sizeof(SIZE_CLASSES) / sizeof(SIZE_CLASSES[0]);
+
+shared_ptr<Buffer>
+BufferPool::acquire(size_t size)
+{
+  size_t sizeClass = 0;
+  while (sizeClass < N_SIZE_CLASSES && SIZE_CLASSES[sizeClass] < size) {
+    ++sizeClass;
+  }
+  if (sizeClass == N_SIZE_CLASSES) {
+    return make_shared<Buffer>(size);
+  }
+
+  thread_local std::array<std::vector<shared_ptr<Buffer>>, N_SIZE_CLASSES> pools;
+  auto& pool = pools[sizeClass];
+  for (const auto& buffer : pool) {
+    if (buffer.use_count() == 1) {
+      // the last other reference may have been released by another thread
+      std::atomic_thread_fence(std::memory_order_acquire);
+      buffer->resize(size);
+      return buffer;
+    }
+  }
+
+  // all pooled buffers are still in use
+  if (pool.size() >= MAX_POOLED_BUFFERS) {
+    return make_shared<Buffer>(size);
+  }
+  auto buffer = make_shared<Buffer>();
+  buffer->reserve(SIZE_CLASSES[sizeClass]);
+  buffer->resize(size);
+  pool.push_back(buffer);
+  return buffer;
+}
+
+} // namespace detail
+} // namespace ndn
@@ -0,0 +1,57 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DETAIL_BUFFER_POOL_HPP
+#define NDN_CXX_DETAIL_BUFFER_POOL_HPP
+
+#include "ndn-cxx/encoding/buffer.hpp"
+
+namespace ndn {
+namespace detail {
+
+/** \brief Thread-local pool of packet buffers.
+ *
+ *  Each thread keeps up to MAX_POOLED_BUFFERS buffers in each of a few size classes, the largest
+ *  of which holds a whole NDN packet. A pooled buffer is handed out again once nothing else
+ *  refers to it, so that encoding or copying packets in steady state neither allocates memory
+ *  nor zero-fills it.
+ */
+class BufferPool
+{
+public:
+  /** \brief Return a Buffer of exactly \p size octets, with unspecified contents.
+   *
+   *  A recycled Buffer keeps the contents of its previous use, except for the octets beyond its
+   *  previous size, which are zero-filled. The caller is expected to overwrite the contents.
+   *  Requests larger than MAX_POOLED_SIZE are served by a new Buffer.
+   */
+  static shared_ptr<Buffer>
+  acquire(size_t size);
+
+public:
+  static constexpr size_t MAX_POOLED_SIZE = 8800;
+  static constexpr size_t MAX_POOLED_BUFFERS = 16;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_DETAIL_BUFFER_POOL_HPP
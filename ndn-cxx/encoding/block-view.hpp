@@ -0,0 +1,293 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_ENCODING_BLOCK_VIEW_HPP
+#define NDN_CXX_ENCODING_BLOCK_VIEW_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+
+#include <iterator>
+
+namespace ndn {
+
+/** @brief Non-owning view of a sub-element within the TLV-VALUE of a Block
+ *
+ *  A BlockView is obtained by iterating over an ElementRange. Unlike a Block, it does not hold
+ *  a reference to the underlying wire Buffer, and therefore it is valid only as long as the
+ *  parent Block is neither modified nor destroyed.
+ */
+class BlockView
+{
+public:
+  /** @brief Return the TLV-TYPE of the sub-element
+   */
+  uint32_t
+  type() const noexcept
+  {
+    return m_type;
+  }
+
+  /** @brief Get begin iterator of the encoded sub-element
+   */
+  Buffer::const_iterator
+  begin() const noexcept
+  {
+    return m_begin;
+  }
+
+  /** @brief Get end iterator of the encoded sub-element
+   */
+  Buffer::const_iterator
+  end() const noexcept
+  {
+    return m_end;
+  }
+
+  /** @brief Return a raw pointer to the beginning of the encoded sub-element
+   */
+  const uint8_t*
+  wire() const noexcept
+  {
+    return &*m_begin;
+  }
+
+  /** @brief Return the size of the encoded sub-element
+   */
+  size_t
+  size() const noexcept
+  {
+    return static_cast<size_t>(std::distance(m_begin, m_end));
+  }
+
+  /** @brief Get begin iterator of TLV-VALUE
+   */
+  Buffer::const_iterator
+  value_begin() const noexcept
+  {
+    return m_valueBegin;
+  }
+
+  /** @brief Get end iterator of TLV-VALUE
+   */
+  Buffer::const_iterator
+  value_end() const noexcept
+  {
+    return m_valueEnd;
+  }
+
+  /** @brief Return a raw pointer to the beginning of TLV-VALUE
+   *  @return nullptr if TLV-VALUE is empty
+   */
+  const uint8_t*
+  value() const noexcept
+  {
+    return value_size() > 0 ? &*m_valueBegin : nullptr;
+  }
+
+  /** @brief Return the size of TLV-VALUE, i.e., the TLV-LENGTH
+   */
+  size_t
+  value_size() const noexcept
+  {
+    return static_cast<size_t>(std::distance(m_valueBegin, m_valueEnd));
+  }
+
+  /** @brief Create a Block for this sub-element
+   *
+   *  The returned Block shares the wire Buffer of the parent Block, and thus remains valid
+   *  after the parent has been modified or destroyed. The TLV-VALUE is not parsed.
+   */
+  Block
+  toBlock() const
+  {
+    return Block(*m_buffer, m_type, m_begin, m_end, m_valueBegin, m_valueEnd);
+  }
+
+private:
+  const ConstBufferPtr* m_buffer = nullptr;
+  uint32_t m_type = tlv::Invalid;
+  Buffer::const_iterator m_begin;
+  Buffer::const_iterator m_end;
+  Buffer::const_iterator m_valueBegin;
+  Buffer::const_iterator m_valueEnd;
+
+  friend class ElementRange;
+};
+
+/** @brief Lazily-parsed range of the sub-elements within the TLV-VALUE of a Block
+ *
+ *  Iterating over an ElementRange decodes the TLV-TYPE and TLV-LENGTH of one sub-element at a
+ *  time, without allocating memory and without touching the reference count of the wire Buffer.
+ *  This is the preferred way to decode a Block whose sub-elements are inspected only once;
+ *  Block::parse() should be used instead when the sub-elements need to be retained.
+ *
+ *  Like BlockView, an ElementRange and its iterators are valid only as long as the parent Block
+ *  is neither modified nor destroyed.
+ */
+class ElementRange
+{
+public:
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = BlockView;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const BlockView*;
+    using reference         = const BlockView&;
+
+    const_iterator() = default;
+
+    reference
+    operator*() const noexcept
+    {
+      return m_view;
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+      return &m_view;
+    }
+
+    /** @brief Advance to the next sub-element
+     *  @throw tlv::Error the next sub-element is malformed or exceeds the parent TLV-VALUE
+     */
+    const_iterator&
+    operator++()
+    {
+      m_view.m_begin = m_view.m_end;
+      decode();
+      return *this;
+    }
+
+    const_iterator
+    operator++(int)
+    {
+      const_iterator copy(*this);
+      ++*this;
+      return copy;
+    }
+
+    friend bool
+    operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+    {
+      return lhs.m_view.begin() == rhs.m_view.begin();
+    }
+
+    friend bool
+    operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+    {
+      return lhs.m_view.begin() != rhs.m_view.begin();
+    }
+
+  private:
+    const_iterator(const ConstBufferPtr* buffer, Buffer::const_iterator pos,
+                   Buffer::const_iterator end)
+      : m_end(end)
+    {
+      m_view.m_buffer = buffer;
+      m_view.m_begin = m_view.m_end = pos;
+      decode();
+    }
+
+    /** @brief Decode Type-Length of the sub-element starting at m_view.m_begin, if any
+     */
+    void
+    decode()
+    {
+      if (m_view.m_begin == m_end) {
+        return;
+      }
+
+      auto pos = m_view.m_begin;
+      m_view.m_type = tlv::readType(pos, m_end);
+      uint64_t length = tlv::readVarNumber(pos, m_end);
+      if (length > static_cast<uint64_t>(std::distance(pos, m_end))) {
+        NDN_THROW(Block::Error("TLV-LENGTH of sub-element of type " + to_string(m_view.m_type) +
+                               " exceeds TLV-VALUE boundary of parent block"));
+      }
+      m_view.m_valueBegin = pos;
+      m_view.m_valueEnd = m_view.m_end = std::next(pos, length);
+    }
+
+  private:
+    BlockView m_view;
+    Buffer::const_iterator m_end;
+
+    friend class ElementRange;
+  };
+
+  /** @brief Create a range over the sub-elements of @p block
+   */
+  explicit
+  ElementRange(const Block& block) noexcept
+    : m_buffer(&block.m_buffer)
+    , m_begin(block.value_begin())
+    , m_end(block.value_end())
+  {
+  }
+
+  /** @brief Create a range over the sub-elements of @p view
+   */
+  explicit
+  ElementRange(const BlockView& view) noexcept
+    : m_buffer(view.m_buffer)
+    , m_begin(view.value_begin())
+    , m_end(view.value_end())
+  {
+  }
+
+  /** @brief Return an iterator to the first sub-element
+   *  @throw tlv::Error the first sub-element is malformed or exceeds the parent TLV-VALUE
+   */
+  const_iterator
+  begin() const
+  {
+    return const_iterator(m_buffer, m_begin, m_end);
+  }
+
+  const_iterator
+  end() const noexcept
+  {
+    const_iterator it;
+    it.m_view.m_buffer = m_buffer;
+    it.m_view.m_begin = it.m_view.m_end = it.m_end = m_end;
+    return it;
+  }
+
+  /** @brief Check whether the parent TLV-VALUE is empty
+   */
+  bool
+  empty() const noexcept
+  {
+    return m_begin == m_end;
+  }
+
+private:
+  const ConstBufferPtr* m_buffer;
+  Buffer::const_iterator m_begin;
+  Buffer::const_iterator m_end;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_ENCODING_BLOCK_VIEW_HPP
@@ -22,6 +22,8 @@
  */
 
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/detail/buffer-pool.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv.hpp"
@@ -64,7 +66,9 @@ Block::Block(span<const uint8_t> buffer)
   std::advance(pos, length);
   // pos now points to the end of the TLV
 
-  m_buffer = std::make_shared<Buffer>(buffer.begin(), pos);
+  auto b = detail::BufferPool::acquire(std::distance(buffer.begin(), pos));
+  std::copy(buffer.begin(), pos, b->begin());
+  m_buffer = std::move(b);
   m_begin = m_buffer->begin();
   m_end = m_buffer->end();
   m_valueBegin = std::prev(m_end, length);
@@ -216,7 +220,8 @@ Block::fromBuffer(span<const uint8_t> buffer)
   std::advance(pos, length);
   // pos now points to the end of the TLV
 
-  auto b = std::make_shared<Buffer>(buffer.begin(), pos);
+  auto b = detail::BufferPool::acquire(std::distance(buffer.begin(), pos));
+  std::copy(buffer.begin(), pos, b->begin());
   return std::make_tuple(true, Block(b, type, b->begin(), b->end(),
                                      std::prev(b->end(), length), b->end()));
 }
@@ -343,24 +348,16 @@ Block::parse() const
   if (!m_elements.empty() || value_size() == 0)
     return;
 
-  auto begin = value_begin();
-  auto end = value_end();
-
-  while (begin != end) {
-    auto pos = begin;
-    uint32_t type = tlv::readType(pos, end);
-    uint64_t length = tlv::readVarNumber(pos, end);
-    if (length > static_cast<uint64_t>(end - pos)) {
-      m_elements.clear();
-      NDN_THROW(Error("TLV-LENGTH of sub-element of type " + to_string(type) +
-                      " exceeds TLV-VALUE boundary of parent block"));
+  try {
+    for (const auto& element : ElementRange(*this)) {
+      m_elements.emplace_back(m_buffer, element.type(), element.begin(), element.end(),
+                              element.value_begin(), element.value_end());
     }
-    // pos now points to TLV-VALUE of sub element
-
-    auto subEnd = std::next(pos, length);
-    m_elements.emplace_back(m_buffer, type, begin, subEnd, pos, subEnd);
-
-    begin = subEnd;
+  }
+  catch (const tlv::Error&) {
+    // leave elements() empty if TLV-VALUE is malformed
+    m_elements.clear();
+    throw;
   }
 }
 
@@ -475,6 +472,19 @@ Block::push_back(const Block& element)
   m_elements.push_back(element);
 }
 
+void
+Block::push_back(Block&& element)
+{
+  resetWire();
+  m_elements.push_back(std::move(element));
+}
+
+void
+Block::reserveElements(size_t n)
+{
+  m_elements.reserve(n);
+}
+
 Block::element_iterator
 Block::insert(Block::element_const_iterator pos, const Block& element)
 {
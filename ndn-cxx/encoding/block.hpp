@@ -387,6 +387,18 @@ public: // sub-elements
   void
   push_back(const Block& element);
 
+  /** @brief Append a sub-element
+   */
+  void
+  push_back(Block&& element);
+
+  /** @brief Reserve room for @p n sub-elements
+   *
+   *  The encoding of this Block is not affected.
+   */
+  void
+  reserveElements(size_t n);
+
   /** @brief Insert a sub-element
    *  @param pos position of the new sub-element
    *  @param element new sub-element to insert
@@ -492,6 +504,8 @@ protected:
    */
   friend std::ostream&
   operator<<(std::ostream& os, const Block& block);
+
+  friend class ElementRange;
 };
 
 inline
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/encoding/encoder.hpp"
+#include "ndn-cxx/detail/buffer-pool.hpp"
 
 #include <boost/endian/conversion.hpp>
 
@@ -29,7 +30,7 @@ namespace encoding {
 namespace endian = boost::endian;
 
 Encoder::Encoder(size_t totalReserve, size_t reserveFromBack)
-  : m_buffer(make_shared<Buffer>(totalReserve))
+  : m_buffer(detail::BufferPool::acquire(totalReserve))
 {
   m_begin = m_end = m_buffer->end() - (reserveFromBack < totalReserve ? reserveFromBack : 0);
 }
@@ -55,6 +56,12 @@ Encoder::reserveFront(size_t size)
     reserve(m_buffer->size() * 2 + size, true);
 }
 
+void
+Encoder::clear(size_t reserveFromBack) noexcept
+{
+  m_begin = m_end = m_buffer->end() - (reserveFromBack < m_buffer->size() ? reserveFromBack : 0);
+}
+
 Block
 Encoder::block(bool verifyLength) const
 {
@@ -72,10 +79,10 @@ Encoder::reserve(size_t size, bool addInFront)
     size_t diffEnd = m_buffer->end() - m_end;
     size_t diffBegin = m_buffer->end() - m_begin;
 
-    Buffer* buf = new Buffer(size);
+    auto buf = detail::BufferPool::acquire(size);
     std::copy_backward(m_buffer->begin(), m_buffer->end(), buf->end());
 
-    m_buffer.reset(buf);
+    m_buffer = std::move(buf);
 
     m_end = m_buffer->end() - diffEnd;
     m_begin = m_buffer->end() - diffBegin;
@@ -84,10 +91,10 @@ Encoder::reserve(size_t size, bool addInFront)
     size_t diffEnd = m_end - m_buffer->begin();
     size_t diffBegin = m_begin - m_buffer->begin();
 
-    Buffer* buf = new Buffer(size);
+    auto buf = detail::BufferPool::acquire(size);
     std::copy(m_buffer->begin(), m_buffer->end(), buf->begin());
 
-    m_buffer.reset(buf);
+    m_buffer = std::move(buf);
 
     m_end = m_buffer->begin() + diffEnd;
     m_begin = m_buffer->begin() + diffBegin;
@@ -221,6 +221,15 @@ public: // unique interface to the Encoder
   void
   reserveFront(size_t size);
 
+  /**
+   * @brief Discard the encoded bytes, keeping the underlying buffer for reuse
+   * @param reserveFromBack number of bytes to reserve for append* operations
+   * @warning Blocks previously created from this encoder share the underlying buffer, and
+   *          will be overwritten by subsequent encoding
+   */
+  void
+  clear(size_t reserveFromBack = 400) noexcept;
+
   /**
    * @brief Get size of the underlying buffer
    */
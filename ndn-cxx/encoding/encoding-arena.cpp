@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/encoding-arena.hpp"
+#include "ndn-cxx/detail/buffer-pool.hpp"
+
+namespace ndn {
+namespace encoding {
+
+constexpr size_t EncodingArena::MAX_RETAINED_CAPACITY;
+
+namespace {
+
+struct ThreadArena
+{
+  unique_ptr<EncodingBuffer> encoder;
+  bool isInUse = false;
+};
+
+ThreadArena&
+getThreadArena()
+{
+  thread_local ThreadArena arena;
+  return arena;
+}
+
+} // namespace
+
+EncodingArena::EncodingArena()
+{
+  auto& arena = getThreadArena();
+  if (arena.isInUse) {
+    m_private = make_unique<EncodingBuffer>();
+    m_encoder = m_private.get();
+    return;
+  }
+
+  if (arena.encoder == nullptr) {
+    arena.encoder = make_unique<EncodingBuffer>();
+  }
+  else {
+    arena.encoder->clear();
+  }
+  arena.isInUse = true;
+  m_encoder = arena.encoder.get();
+}
+
+EncodingArena::~EncodingArena()
+{
+  if (m_private != nullptr) {
+    return;
+  }
+
+  auto& arena = getThreadArena();
+  arena.isInUse = false;
+  if (arena.encoder->capacity() > MAX_RETAINED_CAPACITY) {
+    arena.encoder.reset();
+  }
+}
+
+Block
+EncodingArena::block() const
+{
+  auto buffer = detail::BufferPool::acquire(m_encoder->size());
+  std::copy(m_encoder->begin(), m_encoder->end(), buffer->begin());
+  return Block(std::move(buffer));
+}
+
+} // namespace encoding
+} // namespace ndn
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_ENCODING_ENCODING_ARENA_HPP
+#define NDN_CXX_ENCODING_ENCODING_ARENA_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+
+namespace ndn {
+namespace encoding {
+
+/**
+ * @brief Provides a reusable EncodingBuffer to encode a TLV element in a single pass.
+ *
+ * Each thread has one arena buffer, which is reused by successive EncodingArena instances and
+ * grows only when needed, so that encoding requires neither a size estimation pass nor a new
+ * buffer. If the thread's buffer is already in use, e.g., because encoding an element involves
+ * encoding a nested element with its own arena, a private EncodingBuffer is used instead.
+ *
+ * @code
+ * EncodingArena arena;
+ * wireEncode(arena.encoder());
+ * m_wire = arena.block();
+ * @endcode
+ */
+class EncodingArena : noncopyable
+{
+public:
+  EncodingArena();
+
+  ~EncodingArena();
+
+  /**
+   * @brief Returns the encoder, which is empty when the arena is created.
+   * @warning A Block obtained from the encoder refers to the arena buffer, and is overwritten
+   *          by the next use of the arena. Use block() instead.
+   */
+  EncodingBuffer&
+  encoder() noexcept
+  {
+    return *m_encoder;
+  }
+
+  /**
+   * @brief Returns a copy of the encoded TLV element, in a buffer of its exact size.
+   * @throw tlv::Error The encoded octets are not a single valid TLV element.
+   */
+  Block
+  block() const;
+
+public:
+  /// A thread's arena buffer that has grown beyond this size is released after use.
+  static constexpr size_t MAX_RETAINED_CAPACITY = 65536;
+
+private:
+  unique_ptr<EncodingBuffer> m_private;
+  EncodingBuffer* m_encoder;
+};
+
+} // namespace encoding
+
+using encoding::EncodingArena;
+
+} // namespace ndn
+
+#endif // NDN_CXX_ENCODING_ENCODING_ARENA_HPP
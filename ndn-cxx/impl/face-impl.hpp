@@ -94,7 +94,8 @@ public: // consumer
 
     const Interest& interest2 = *interest;
     auto& entry = m_pendingInterestTable.put(id, std::move(interest), afterSatisfied,
-                                             afterNacked, afterTimeout, m_scheduler);
+                                             afterNacked, afterTimeout, m_scheduler,
+                                             m_pendingInterestIndex);
 
     lp::Packet lpPacket;
     addFieldFromTag<lp::NextHopFaceIdField, lp::NextHopFaceIdTag>(lpPacket, interest2);
@@ -129,7 +130,8 @@ public: // consumer
   satisfyPendingInterests(const Data& data)
   {
     bool hasAppMatch = false, hasForwarderMatch = false;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
+    m_pendingInterestTable.removeIf(m_pendingInterestIndex.findDataCandidates(data),
+                                    [&] (PendingInterest& entry) {
       if (!entry.getInterest()->matchesData(data)) {
         return false;
       }
@@ -156,7 +158,8 @@ public: // consumer
   nackPendingInterests(const lp::Nack& nack)
   {
     optional<lp::Nack> outNack;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
+    m_pendingInterestTable.removeIf(m_pendingInterestIndex.findNackCandidates(nack),
+                                    [&] (PendingInterest& entry) {
       if (!nack.getInterest().matchesInterest(*entry.getInterest())) {
         return false;
       }
@@ -187,7 +190,7 @@ public: // producer
   setInterestFilter(detail::RecordId id, const InterestFilter& filter, const InterestCallback& onInterest)
   {
     NDN_LOG_INFO("setting InterestFilter: " << filter);
-    m_interestFilterTable.put(id, filter, onInterest);
+    m_interestFilterTable.put(id, filter, onInterest, m_interestFilterIndex);
   }
 
   void
@@ -205,7 +208,8 @@ public: // producer
   processIncomingInterest(shared_ptr<const Interest> interest)
   {
     const Interest& interest2 = *interest;
-    auto& entry = m_pendingInterestTable.insert(std::move(interest), m_scheduler);
+    auto& entry = m_pendingInterestTable.insert(std::move(interest), m_scheduler,
+                                                m_pendingInterestIndex);
     dispatchInterest(entry, interest2);
   }
 
@@ -267,7 +271,8 @@ public: // prefix registration
         detail::RecordId filterId = 0;
         if (filter) {
           NDN_LOG_INFO("setting InterestFilter: " << *filter);
-          auto& filterRecord = m_interestFilterTable.insert(*filter, onInterest);
+          auto& filterRecord = m_interestFilterTable.insert(*filter, onInterest,
+                                                            m_interestFilterIndex);
           filterId = filterRecord.getId();
         }
         m_registeredPrefixTable.put(id, prefix, options, filterId);
@@ -347,7 +352,8 @@ private:
   void
   dispatchInterest(PendingInterest& entry, const Interest& interest)
   {
-    m_interestFilterTable.forEach([&] (const InterestFilterRecord& filter) {
+    m_interestFilterTable.forEach(m_interestFilterIndex.findCandidates(interest.getName()),
+                                  [&] (const InterestFilterRecord& filter) {
       if (!filter.doesMatch(entry)) {
         return;
       }
@@ -410,7 +416,9 @@ private:
   scheduler::ScopedEventId m_processEventsTimeoutEvent;
   nfd::Controller m_nfdController;
 
+  PendingInterestIndex m_pendingInterestIndex; // must outlive m_pendingInterestTable
   detail::RecordContainer<PendingInterest> m_pendingInterestTable;
+  InterestFilterIndex m_interestFilterIndex; // must outlive m_interestFilterTable
   detail::RecordContainer<InterestFilterRecord> m_interestFilterTable;
   detail::RecordContainer<RegisteredPrefix> m_registeredPrefixTable;
 
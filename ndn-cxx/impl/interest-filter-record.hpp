@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2021 Regents of the University of California.
+ * Copyright (c) 2013-2022 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -25,8 +25,50 @@
 #include "ndn-cxx/impl/pending-interest.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 
+#include <unordered_map>
+
 namespace ndn {
 
+class InterestFilterRecord;
+
+/**
+ * @brief Index of InterestFilter records by name prefix, kept alongside the RecordContainer.
+ *
+ * The index is a hashed name tree: each record is attached to the node of its filter prefix,
+ * and nodes are found by hashing name prefixes. A lookup visits the nodes of every prefix of
+ * the Interest name, so its cost depends on the length of the name rather than the number of
+ * filters. Regular expressions are not evaluated here; a filter with a regex is only returned
+ * as a candidate when its prefix node is on the path of the Interest name. Callers must still
+ * confirm the match with InterestFilterRecord::doesMatch.
+ */
+class InterestFilterIndex : noncopyable
+{
+public:
+  using Candidates = std::vector<detail::RecordId>;
+
+  void
+  insert(InterestFilterRecord& record);
+
+  void
+  erase(InterestFilterRecord& record);
+
+  /**
+   * @brief Find records whose filter prefix may be a prefix of @p name.
+   * @return record IDs in ascending order, i.e., in the order the records were inserted
+   */
+  Candidates
+  findCandidates(const Name& name) const;
+
+  size_t
+  size() const noexcept
+  {
+    return m_index.size();
+  }
+
+private:
+  std::unordered_multimap<size_t, InterestFilterRecord*> m_index;
+};
+
 /**
  * @brief Associates an InterestFilter with an Interest callback.
  */
@@ -38,11 +80,20 @@ public:
    *
    * @param filter an InterestFilter that represents what Interest should invoke the callback
    * @param callback invoked when matching Interest is received
+   * @param index the index in which this record is registered during its lifetime
    */
-  InterestFilterRecord(const InterestFilter& filter, const InterestCallback& callback)
+  InterestFilterRecord(const InterestFilter& filter, const InterestCallback& callback,
+                       InterestFilterIndex& index)
     : m_filter(filter)
     , m_interestCallback(callback)
+    , m_index(index)
+  {
+    m_index.insert(*this);
+  }
+
+  ~InterestFilterRecord()
   {
+    m_index.erase(*this);
   }
 
   const InterestFilter&
@@ -77,8 +128,51 @@ public:
 private:
   InterestFilter m_filter;
   InterestCallback m_interestCallback;
+  InterestFilterIndex& m_index;
 };
 
+inline void
+InterestFilterIndex::insert(InterestFilterRecord& record)
+{
+  m_index.emplace(record.getFilter().getPrefix().getHash(), &record);
+}
+
+inline void
+InterestFilterIndex::erase(InterestFilterRecord& record)
+{
+  auto range = m_index.equal_range(record.getFilter().getPrefix().getHash());
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == &record) {
+      m_index.erase(it);
+      return;
+    }
+  }
+}
+
+inline InterestFilterIndex::Candidates
+InterestFilterIndex::findCandidates(const Name& name) const
+{
+  Candidates candidates;
+  if (m_index.empty()) {
+    return candidates;
+  }
+
+  auto collect = [&] (size_t key) {
+    auto range = m_index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      candidates.push_back(it->second->getId());
+    }
+  };
+
+  for (size_t key : name.getPrefixHashes()) {
+    collect(key);
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+  return candidates;
+}
+
 } // namespace ndn
 
 #endif // NDN_CXX_IMPL_INTEREST_FILTER_RECORD_HPP
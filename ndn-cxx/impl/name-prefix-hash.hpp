@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_NAME_PREFIX_HASH_HPP
+#define NDN_CXX_IMPL_NAME_PREFIX_HASH_HPP
+
+#include "ndn-cxx/name.hpp"
+
+#include <boost/functional/hash.hpp>
+
+namespace ndn {
+namespace detail {
+
+/**
+ * @brief Incrementally computes the hashes of successive prefixes of a name.
+ *
+ * The hash of a prefix depends only on the TLV-TYPE and TLV-VALUE of its components, so that
+ * equal names have equal hashes regardless of how their wire encoding was obtained.
+ * Name::getHash() and Name::getPrefixHashes() are computed with this class.
+ */
+class NamePrefixHasher
+{
+public:
+  /**
+   * @brief Return the hash of the components appended so far.
+   */
+  size_t
+  get() const noexcept
+  {
+    return m_seed;
+  }
+
+  /**
+   * @brief Extend the hashed prefix by one component.
+   */
+  NamePrefixHasher&
+  append(const name::Component& component)
+  {
+    boost::hash_combine(m_seed, component.type());
+    boost::hash_combine(m_seed, component.value_size());
+    boost::hash_range(m_seed, component.value_begin(), component.value_end());
+    return *this;
+  }
+
+private:
+  size_t m_seed = 0;
+};
+
+/**
+ * @brief Compute the hash of the first @p nComponents components of @p name.
+ */
+inline size_t
+hashNamePrefix(const Name& name, size_t nComponents = Name::npos)
+{
+  NamePrefixHasher hasher;
+  auto end = name.begin() + std::min(nComponents, name.size());
+  for (auto it = name.begin(); it != end; ++it) {
+    hasher.append(*it);
+  }
+  return hasher.get();
+}
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_NAME_PREFIX_HASH_HPP
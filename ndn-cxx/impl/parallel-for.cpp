@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/parallel-for.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace ndn {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Process-wide pool of threads that help callers of runParallelRanges().
+ *
+ * Each call publishes a batch of ranges. The caller and any idle workers claim ranges from
+ * the batch one at a time until none is left. Because the caller claims ranges of its own
+ * batch as well, every batch completes even if no worker is available, e.g., when the pool
+ * could not start a thread, or when runParallelRanges() is invoked from a worker.
+ */
+class WorkerPool : noncopyable
+{
+public:
+  static WorkerPool&
+  get()
+  {
+    static WorkerPool pool;
+    return pool;
+  }
+
+  ~WorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isStopped = true;
+    }
+    m_hasWork.notify_all();
+    for (auto& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  void
+  run(size_t nRanges, const std::function<void(size_t)>& runRange)
+  {
+    Batch batch{runRange, nRanges};
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    startWorkers(nRanges - 1);
+    m_batches.push_back(&batch);
+    m_hasWork.notify_all();
+
+    while (batch.next < nRanges) {
+      processRange(batch, lock);
+    }
+    m_hasCompleted.wait(lock, [&] { return batch.nCompleted == nRanges; });
+  }
+
+private:
+  struct Batch
+  {
+    const std::function<void(size_t)>& runRange;
+    size_t nRanges;
+    size_t next = 0; ///< index of the next unclaimed range
+    size_t nCompleted = 0;
+  };
+
+  /**
+   * @brief Start workers until there are at least @p nWorkers of them
+   * @pre m_mutex is locked
+   */
+  void
+  startWorkers(size_t nWorkers)
+  {
+    try {
+      while (m_workers.size() < nWorkers) {
+        m_workers.emplace_back([this] { work(); });
+      }
+    }
+    catch (const std::system_error&) {
+      // continue with the workers started so far; callers process their own ranges anyway
+    }
+  }
+
+  /**
+   * @brief Claim the next range of @p batch and process it with @p lock released
+   * @pre @p lock is locked and `batch.next < batch.nRanges`
+   */
+  void
+  processRange(Batch& batch, std::unique_lock<std::mutex>& lock)
+  {
+    size_t i = batch.next++;
+    if (batch.next == batch.nRanges) {
+      m_batches.erase(std::find(m_batches.begin(), m_batches.end(), &batch));
+    }
+
+    lock.unlock();
+    batch.runRange(i);
+    lock.lock();
+
+    if (++batch.nCompleted == batch.nRanges) {
+      m_hasCompleted.notify_all();
+    }
+  }
+
+  void
+  work()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_hasWork.wait(lock, [this] { return m_isStopped || !m_batches.empty(); });
+      if (m_isStopped) {
+        return;
+      }
+      processRange(*m_batches.front(), lock);
+    }
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_hasWork;
+  std::condition_variable m_hasCompleted;
+  std::deque<Batch*> m_batches; ///< batches with unclaimed ranges
+  std::vector<std::thread> m_workers;
+  bool m_isStopped = false;
+};
+
+} // namespace
+
+void
+runParallelRanges(size_t nRanges, const std::function<void(size_t)>& runRange)
+{
+  if (nRanges == 1) {
+    runRange(0);
+    return;
+  }
+  if (nRanges > 1) {
+    WorkerPool::get().run(nRanges, runRange);
+  }
+}
+
+} // namespace detail
+} // namespace ndn
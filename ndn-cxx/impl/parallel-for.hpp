@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_PARALLEL_FOR_HPP
+#define NDN_CXX_IMPL_PARALLEL_FOR_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace ndn {
+namespace detail {
+
+/**
+ * @brief Invoke `runRange(i)` for each i in [0, @p nRanges), each on a single thread.
+ *
+ * The calling thread processes ranges too, while up to `nRanges - 1` threads of a persistent
+ * process-wide worker pool help with the others. The function returns after all ranges have
+ * been processed. @p runRange must not throw.
+ */
+void
+runParallelRanges(size_t nRanges, const std::function<void(size_t)>& runRange);
+
+/**
+ * @brief Split [0, @p n) into at most @p nThreads contiguous ranges and invoke
+ *        `f(begin, end)` for each range, each on a single thread.
+ *
+ * The ranges are processed by the calling thread and by threads of a persistent worker pool,
+ * so that no thread is created per call. The function returns after all ranges have been
+ * processed; if any invocation of @p f throws, the first exception (in range order) is
+ * rethrown. Because each range is processed on a single thread, @p f may keep per-thread
+ * state, such as OpenSSL contexts, in local variables.
+ */
+template<typename F>
+void
+parallelFor(size_t n, size_t nThreads, const F& f)
+{
+  nThreads = std::max<size_t>(1, std::min(nThreads, n));
+  if (nThreads == 1) {
+    if (n > 0) {
+      f(size_t(0), n);
+    }
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(nThreads);
+  runParallelRanges(nThreads, [&] (size_t i) {
+    try {
+      f(n * i / nThreads, n * (i + 1) / nThreads);
+    }
+    catch (...) {
+      errors[i] = std::current_exception();
+    }
+  });
+
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_PARALLEL_FOR_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2021 Regents of the University of California.
+ * Copyright (c) 2013-2022 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -25,12 +25,17 @@
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/impl/name-prefix-hash.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 
+#include <unordered_map>
+
 namespace ndn {
 
+class PendingInterest;
+
 /**
  * @brief Indicates where a pending Interest came from.
  */
@@ -40,7 +45,7 @@ enum class PendingInterestOrigin
   FORWARDER ///< Interest was received from the forwarder via Transport
 };
 
-std::ostream&
+inline std::ostream&
 operator<<(std::ostream& os, PendingInterestOrigin origin)
 {
   switch (origin) {
@@ -52,6 +57,63 @@ operator<<(std::ostream& os, PendingInterestOrigin origin)
   NDN_CXX_UNREACHABLE;
 }
 
+/**
+ * @brief Index of pending Interests by name, kept alongside the RecordContainer.
+ *
+ * Each record is keyed by a hash of its Interest name. A trailing ImplicitSha256Digest
+ * component is left out of the key, so that an Interest carrying the full name of a Data
+ * packet can be found without computing the digest of every incoming Data. Lookups return
+ * candidates only; callers must still confirm the match with Interest::matchesData or
+ * Interest::matchesInterest, because distinct names may share a key.
+ */
+class PendingInterestIndex : noncopyable
+{
+public:
+  using Candidates = std::vector<detail::RecordId>;
+
+  void
+  insert(PendingInterest& entry);
+
+  void
+  erase(PendingInterest& entry);
+
+  /**
+   * @brief Find records that may be satisfied by @p data.
+   * @return record IDs in ascending order, i.e., in the order the records were inserted
+   *
+   * The cost is proportional to the number of components in the Data name plus the number of
+   * candidates returned, and does not depend on the total number of pending Interests.
+   */
+  Candidates
+  findDataCandidates(const Data& data) const;
+
+  /**
+   * @brief Find records that may be Nacked by @p nack.
+   * @return record IDs in ascending order
+   */
+  Candidates
+  findNackCandidates(const lp::Nack& nack) const;
+
+  size_t
+  size() const noexcept
+  {
+    return m_index.size();
+  }
+
+private:
+  /**
+   * @brief Compute the key of a pending Interest name.
+   */
+  static size_t
+  computeKey(const Name& name);
+
+  void
+  collect(size_t key, Candidates& candidates) const;
+
+private:
+  std::unordered_multimap<size_t, PendingInterest*> m_index;
+};
+
 /**
  * @brief Stores a pending Interest and associated callbacks.
  */
@@ -66,24 +128,34 @@ public:
    */
   PendingInterest(shared_ptr<const Interest> interest, const DataCallback& dataCallback,
                   const NackCallback& nackCallback, const TimeoutCallback& timeoutCallback,
-                  Scheduler& scheduler)
+                  Scheduler& scheduler, PendingInterestIndex& index)
     : m_interest(std::move(interest))
     , m_origin(PendingInterestOrigin::APP)
     , m_dataCallback(dataCallback)
     , m_nackCallback(nackCallback)
     , m_timeoutCallback(timeoutCallback)
+    , m_index(index)
   {
     scheduleTimeoutEvent(scheduler);
+    m_index.insert(*this);
   }
 
   /**
    * @brief Construct a pending Interest record for an Interest from the forwarder
    */
-  PendingInterest(shared_ptr<const Interest> interest, Scheduler& scheduler)
+  PendingInterest(shared_ptr<const Interest> interest, Scheduler& scheduler,
+                  PendingInterestIndex& index)
     : m_interest(std::move(interest))
     , m_origin(PendingInterestOrigin::FORWARDER)
+    , m_index(index)
   {
     scheduleTimeoutEvent(scheduler);
+    m_index.insert(*this);
+  }
+
+  ~PendingInterest()
+  {
+    m_index.erase(*this);
   }
 
   shared_ptr<const Interest>
@@ -181,8 +253,73 @@ private:
   scheduler::ScopedEventId m_timeoutEvent;
   int m_nNotNacked = 0; ///< number of Interest destinations that have not Nacked
   optional<lp::Nack> m_leastSevereNack;
+  PendingInterestIndex& m_index;
 };
 
+inline void
+PendingInterestIndex::insert(PendingInterest& entry)
+{
+  m_index.emplace(computeKey(entry.getInterest()->getName()), &entry);
+}
+
+inline void
+PendingInterestIndex::erase(PendingInterest& entry)
+{
+  auto range = m_index.equal_range(computeKey(entry.getInterest()->getName()));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == &entry) {
+      m_index.erase(it);
+      return;
+    }
+  }
+}
+
+inline PendingInterestIndex::Candidates
+PendingInterestIndex::findDataCandidates(const Data& data) const
+{
+  Candidates candidates;
+  if (m_index.empty()) {
+    return candidates;
+  }
+
+  // an Interest can match the Data only if its name (without a trailing implicit digest)
+  // is a prefix of the Data name, so probe the key of every prefix
+  for (size_t key : data.getName().getPrefixHashes()) {
+    collect(key, candidates);
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+  return candidates;
+}
+
+inline PendingInterestIndex::Candidates
+PendingInterestIndex::findNackCandidates(const lp::Nack& nack) const
+{
+  Candidates candidates;
+  collect(computeKey(nack.getInterest().getName()), candidates);
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+inline size_t
+PendingInterestIndex::computeKey(const Name& name)
+{
+  if (!name.empty() && name.get(-1).isImplicitSha256Digest()) {
+    return detail::hashNamePrefix(name, name.size() - 1);
+  }
+  return name.getHash();
+}
+
+inline void
+PendingInterestIndex::collect(size_t key, Candidates& candidates) const
+{
+  auto range = m_index.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    candidates.push_back(it->second->getId());
+  }
+}
+
 } // namespace ndn
 
 #endif // NDN_CXX_IMPL_PENDING_INTEREST_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2021 Regents of the University of California.
+ * Copyright (c) 2013-2022 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -159,6 +159,27 @@ public:
     }
   }
 
+  /** \brief Visit selected records with the option to erase.
+   *  \tparam IdRange range of RecordId
+   *  \tparam Visitor function of type 'bool f(Record& record)'
+   *  \param ids IDs of records to visit, in visiting order; nonexistent IDs are skipped
+   *  \param f visitor function, return true to erase record
+   */
+  template<typename IdRange, typename Visitor>
+  void
+  removeIf(const IdRange& ids, const Visitor& f)
+  {
+    for (RecordId id : ids) {
+      auto i = m_container.find(id);
+      if (i != m_container.end() && f(i->second)) {
+        m_container.erase(i);
+      }
+    }
+    if (empty()) {
+      this->onEmpty();
+    }
+  }
+
   /** \brief Visit all records.
    *  \tparam Visitor function of type 'void f(Record& record)'
    *  \param f visitor function
@@ -173,6 +194,22 @@ public:
     });
   }
 
+  /** \brief Visit selected records.
+   *  \tparam IdRange range of RecordId
+   *  \tparam Visitor function of type 'void f(Record& record)'
+   *  \param ids IDs of records to visit, in visiting order; nonexistent IDs are skipped
+   *  \param f visitor function
+   */
+  template<typename IdRange, typename Visitor>
+  void
+  forEach(const IdRange& ids, const Visitor& f)
+  {
+    removeIf(ids, [&f] (Record& record) {
+      f(record);
+      return false;
+    });
+  }
+
   NDN_CXX_NODISCARD bool
   empty() const noexcept
   {
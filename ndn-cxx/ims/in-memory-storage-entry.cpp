@@ -24,7 +24,10 @@
 namespace ndn {
 
 InMemoryStorageEntry::InMemoryStorageEntry()
-  : m_isFresh(true)
+  : m_memoryUsage(0)
+  , m_isFresh(true)
+  , m_staleTick(0)
+  , m_staleIndex(std::numeric_limits<size_t>::max())
 {
 }
 
@@ -32,20 +35,23 @@ void
 InMemoryStorageEntry::release()
 {
   m_dataPacket.reset();
-  m_markStaleEventId.cancel();
+  m_memoryUsage = 0;
 }
 
-void
-InMemoryStorageEntry::setData(const Data& data)
+size_t
+InMemoryStorageEntry::computeMemoryUsage(const Data& data)
 {
-  m_dataPacket = data.shared_from_this();
-  m_isFresh = true;
+  return sizeof(InMemoryStorageEntry) + sizeof(Data) +
+         data.getName().size() * sizeof(name::Component) +
+         data.wireEncode().size();
 }
 
 void
-InMemoryStorageEntry::scheduleMarkStale(Scheduler& sched, time::nanoseconds after)
+InMemoryStorageEntry::setData(const Data& data)
 {
-  m_markStaleEventId = sched.schedule(after, [this] { m_isFresh = false; });
+  m_dataPacket = data.shared_from_this();
+  m_memoryUsage = computeMemoryUsage(data);
+  m_isFresh = true;
 }
 
 } // namespace ndn
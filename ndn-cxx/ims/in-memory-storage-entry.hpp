@@ -24,7 +24,6 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/interest.hpp"
-#include "ndn-cxx/util/scheduler.hpp"
 
 namespace ndn {
 
@@ -67,6 +66,22 @@ public:
     return *m_dataPacket;
   }
 
+  /** @brief Returns the number of bytes accounted to this entry
+   *
+   *  This is the memory used by the entry itself, the Data object, its Name components, and
+   *  its wire encoding, as computed by computeMemoryUsage() when the Data was set.
+   */
+  size_t
+  getMemoryUsage() const
+  {
+    return m_memoryUsage;
+  }
+
+  /** @brief Computes the number of bytes that an entry storing @p data accounts for
+   */
+  static size_t
+  computeMemoryUsage(const Data& data);
+
   /** @brief Changes the content of in-memory storage entry
    *
    *  This method also allows data to satisfy Interest with MustBeFresh
@@ -74,10 +89,13 @@ public:
   void
   setData(const Data& data);
 
-  /** @brief Schedule an event to mark this entry as non-fresh.
+  /** @brief Mark this entry as non-fresh
    */
   void
-  scheduleMarkStale(Scheduler& sched, time::nanoseconds after);
+  markStale()
+  {
+    m_isFresh = false;
+  }
 
   /** @brief Check if the data can satisfy an interest with MustBeFresh
    */
@@ -89,9 +107,15 @@ public:
 
 private:
   shared_ptr<const Data> m_dataPacket;
+  size_t m_memoryUsage;
 
   bool m_isFresh;
-  scheduler::ScopedEventId m_markStaleEventId;
+
+  /// position in the expiry buckets of the owning InMemoryStorage, if scheduled to become stale
+  uint64_t m_staleTick;
+  size_t m_staleIndex;
+
+  friend class InMemoryStorage;
 };
 
 } // namespace ndn
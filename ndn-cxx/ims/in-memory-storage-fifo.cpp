@@ -45,7 +45,7 @@ InMemoryStorageFifo::evictItem()
 {
   if (!m_cleanupIndex.get<byArrival>().empty()) {
     CleanupIndex::index<byArrival>::type::iterator it = m_cleanupIndex.get<byArrival>().begin();
-    eraseImpl((*it)->getFullName());
+    eraseImpl(*it);
     m_cleanupIndex.get<byArrival>().erase(it);
     return true;
   }
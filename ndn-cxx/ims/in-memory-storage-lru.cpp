@@ -47,7 +47,7 @@ InMemoryStorageLru::evictItem()
 {
   if (!m_cleanupIndex.get<byUsedTime>().empty()) {
     CleanupIndex::index<byUsedTime>::type::iterator it = m_cleanupIndex.get<byUsedTime>().begin();
-    eraseImpl((*it)->getFullName());
+    eraseImpl(*it);
     m_cleanupIndex.get<byUsedTime>().erase(it);
     return true;
   }
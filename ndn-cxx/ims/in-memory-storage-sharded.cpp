@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+
+namespace ndn {
+
+/** @brief Returns whether the last component of @p name is an implicit digest
+ */
+static bool
+hasImplicitDigest(const Name& name)
+{
+  return !name.empty() && name[-1].isImplicitSha256Digest();
+}
+
+InMemoryStorageSharded::InMemoryStorageSharded(size_t nShards, const ShardFactory& makeShard)
+{
+  BOOST_ASSERT(nShards > 0);
+
+  m_shards.reserve(nShards);
+  for (size_t i = 0; i < nShards; ++i) {
+    m_shards.push_back(make_unique<Shard>());
+    m_shards.back()->storage = makeShard();
+    // the scheduler would mark packets as non-fresh from the io_service thread, without the lock
+    if (m_shards.back()->storage->m_scheduler != nullptr) {
+      NDN_THROW(std::invalid_argument("InMemoryStorageSharded shards cannot use an io_service"));
+    }
+  }
+}
+
+InMemoryStorageSharded::Shard&
+InMemoryStorageSharded::getShard(const Name& dataName)
+{
+  // mix the bits of the name hash, whose low bits alone may not be well distributed
+  uint64_t hash = dataName.getHash();
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return *m_shards[hash % m_shards.size()];
+}
+
+void
+InMemoryStorageSharded::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
+{
+  // the full name is cached in a mutable member of Data, so it must be computed before the
+  // packet is shared; afterwards, it is only read, whichever thread finds the packet
+  data.getFullName();
+
+  Shard& shard = getShard(data.getName());
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.storage->insert(data, mustBeFreshProcessingWindow);
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Interest& interest)
+{
+  auto findInShard = [&interest] (Shard& shard) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (interest.getMustBeFresh()) {
+      shard.storage->markStaleEntries();
+    }
+    return shard.storage->find(interest);
+  };
+
+  const Name& name = interest.getName();
+  if (hasImplicitDigest(name)) {
+    // a Data whose full name is the Interest name is stored in the shard of its name
+    auto found = findInShard(getShard(name.getPrefix(-1)));
+    if (found != nullptr || !interest.getCanBePrefix()) {
+      return found;
+    }
+  }
+  else if (!interest.getCanBePrefix()) {
+    return findInShard(getShard(name));
+  }
+
+  for (const auto& shard : m_shards) {
+    auto found = findInShard(*shard);
+    if (found != nullptr) {
+      return found;
+    }
+  }
+  return nullptr;
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Name& name)
+{
+  auto findInShard = [&name] (Shard& shard) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.storage->find(name);
+  };
+
+  if (hasImplicitDigest(name)) {
+    auto found = findInShard(getShard(name.getPrefix(-1)));
+    if (found != nullptr) {
+      return found;
+    }
+  }
+
+  for (const auto& shard : m_shards) {
+    auto found = findInShard(*shard);
+    if (found != nullptr) {
+      return found;
+    }
+  }
+  return nullptr;
+}
+
+void
+InMemoryStorageSharded::erase(const Name& prefix, bool isPrefix)
+{
+  if (!isPrefix) {
+    // only a full name can identify a stored packet
+    if (hasImplicitDigest(prefix)) {
+      Shard& shard = getShard(prefix.getPrefix(-1));
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.storage->erase(prefix, false);
+    }
+    return;
+  }
+
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->storage->erase(prefix, true);
+  }
+}
+
+size_t
+InMemoryStorageSharded::size() const
+{
+  size_t n = 0;
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    n += shard->storage->size();
+  }
+  return n;
+}
+
+InMemoryStorage::Counters
+InMemoryStorageSharded::getCounters() const
+{
+  InMemoryStorage::Counters counters;
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    const auto& c = shard->storage->getCounters();
+    counters.nEntries += c.nEntries;
+    counters.nBytes += c.nBytes;
+    counters.nEvictions += c.nEvictions;
+  }
+  return counters;
+}
+
+} // namespace ndn
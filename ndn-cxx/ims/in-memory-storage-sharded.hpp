@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+#define NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <mutex>
+
+namespace ndn {
+
+/** @brief Provides an in-memory storage that can be used concurrently from multiple threads
+ *
+ *  Packets are distributed among several shards by the hash of their name. Each shard is an
+ *  InMemoryStorage with its own replacement policy and limits, protected by its own mutex.
+ *  Insertions and lookups that determine the name of the packet, i.e., Interests without
+ *  CanBePrefix and full names, lock a single shard. Prefix lookups and erasures visit every
+ *  shard in turn, and return the match of the first shard that has one.
+ *
+ *  The shards are not tied to an io_service: packets whose MustBeFresh processing window has
+ *  elapsed are marked as non-fresh when a shard is looked up with MustBeFresh.
+ *
+ *  @note The returned Data packets are shared between threads, and must not be modified.
+ */
+class InMemoryStorageSharded : noncopyable
+{
+public:
+  using ShardFactory = std::function<unique_ptr<InMemoryStorage>()>;
+
+  /** @brief Create a sharded in-memory storage
+   *  @param nShards number of shards, must be positive
+   *  @param makeShard creates each shard, which must not be created with an io_service
+   *  @throw std::invalid_argument a shard was created with an io_service
+   */
+  InMemoryStorageSharded(size_t nShards, const ShardFactory& makeShard);
+
+  /** @brief Inserts a Data packet into its shard
+   *
+   *  The shard keeps a reference to @p data rather than a copy. Its full name, which Data
+   *  computes lazily, is computed on the calling thread before the packet becomes visible to
+   *  other threads.
+   *
+   *  @sa InMemoryStorage::insert
+   */
+  void
+  insert(const Data& data,
+         const time::milliseconds& mustBeFreshProcessingWindow = InMemoryStorage::INFINITE_WINDOW);
+
+  /** @brief Finds a Data packet matching an Interest
+   *  @sa InMemoryStorage::find(const Interest&)
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest);
+
+  /** @brief Finds a Data packet under a Name with or without the implicit digest
+   *  @sa InMemoryStorage::find(const Name&)
+   */
+  shared_ptr<const Data>
+  find(const Name& name);
+
+  /** @brief Deletes Data packets by prefix, or by full name if @p isPrefix is false
+   *  @sa InMemoryStorage::erase
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /** @return{ number of packets stored in all shards }
+   */
+  size_t
+  size() const;
+
+  /** @brief Returns the sum of the statistics of all shards
+   */
+  InMemoryStorage::Counters
+  getCounters() const;
+
+  size_t
+  getNShards() const
+  {
+    return m_shards.size();
+  }
+
+private:
+  struct Shard
+  {
+    mutable std::mutex mutex;
+    unique_ptr<InMemoryStorage> storage;
+  };
+
+  /** @brief Returns the shard of Data packets named @p dataName
+   */
+  Shard&
+  getShard(const Name& dataName);
+
+private:
+  std::vector<unique_ptr<Shard>> m_shards;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
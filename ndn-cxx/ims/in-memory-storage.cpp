@@ -26,6 +26,109 @@ namespace ndn {
 
 const time::milliseconds InMemoryStorage::INFINITE_WINDOW(-1);
 const time::milliseconds InMemoryStorage::ZERO_WINDOW(0);
+const time::milliseconds InMemoryStorage::STALE_TICK(10);
+
+/** @brief Three-way comparison of the full name of @p data with @p name
+ *
+ *  The implicit digest of @p data is computed only if @p name contains an implicit digest
+ *  component right after the name of @p data.
+ */
+static int
+compareFullName(const Data& data, const Name& name)
+{
+  const Name& dataName = data.getName();
+  size_t n = dataName.size();
+  int cmp = dataName.compare(0, n, name, 0, n);
+  if (cmp != 0 || name.size() <= n) {
+    // the full name is longer than the name of the Data by one component
+    return cmp != 0 ? cmp : 1;
+  }
+
+  // ImplicitSha256Digest has the smallest TLV-TYPE among valid name components
+  if (!name[n].isImplicitSha256Digest()) {
+    return -1;
+  }
+  cmp = data.getFullName()[n].compare(name[n]);
+  if (cmp != 0) {
+    return cmp;
+  }
+  return name.size() == n + 1 ? 0 : -1;
+}
+
+/** @brief Three-way comparison of the full names of @p lhs and @p rhs
+ *
+ *  The implicit digests are computed only if both Data packets have the same name but
+ *  different wire encodings, or if the name of one packet ends with the digest of the other.
+ */
+static int
+compareFullName(const Data& lhs, const Data& rhs)
+{
+  const Name& lhsName = lhs.getName();
+  const Name& rhsName = rhs.getName();
+  if (lhsName.size() < rhsName.size()) {
+    int cmp = compareFullName(lhs, rhsName);
+    return cmp != 0 ? cmp : -1;
+  }
+  if (lhsName.size() > rhsName.size()) {
+    int cmp = compareFullName(rhs, lhsName);
+    return cmp != 0 ? -cmp : 1;
+  }
+
+  int cmp = lhsName.compare(rhsName);
+  if (cmp != 0) {
+    return cmp;
+  }
+
+  const Block& lhsWire = lhs.wireEncode();
+  const Block& rhsWire = rhs.wireEncode();
+  if (lhsWire.size() == rhsWire.size() &&
+      std::equal(lhsWire.begin(), lhsWire.end(), rhsWire.begin())) {
+    return 0;
+  }
+  return lhs.getFullName()[-1].compare(rhs.getFullName()[-1]);
+}
+
+/** @brief Check whether @p name is a prefix of the full name of @p data
+ */
+static bool
+isPrefixOfFullName(const Name& name, const Data& data)
+{
+  if (name.size() <= data.getName().size()) {
+    return name.isPrefixOf(data.getName());
+  }
+  return name.size() == data.getName().size() + 1 && compareFullName(data, name) == 0;
+}
+
+bool
+InMemoryStorage::FullNameLess::operator()(const InMemoryStorageEntry* lhs,
+                                          const InMemoryStorageEntry* rhs) const
+{
+  return compareFullName(lhs->getData(), rhs->getData()) < 0;
+}
+
+bool
+InMemoryStorage::FullNameLess::operator()(const InMemoryStorageEntry* lhs, const Name& rhs) const
+{
+  return compareFullName(lhs->getData(), rhs) < 0;
+}
+
+bool
+InMemoryStorage::FullNameLess::operator()(const Name& lhs, const InMemoryStorageEntry* rhs) const
+{
+  return compareFullName(rhs->getData(), lhs) > 0;
+}
+
+bool
+InMemoryStorage::FullNameLess::operator()(const InMemoryStorageEntry* lhs, const Data& rhs) const
+{
+  return compareFullName(lhs->getData(), rhs) < 0;
+}
+
+bool
+InMemoryStorage::FullNameLess::operator()(const Data& lhs, const InMemoryStorageEntry* rhs) const
+{
+  return compareFullName(lhs, rhs->getData()) < 0;
+}
 
 InMemoryStorage::const_iterator::const_iterator(const Data* ptr, const Cache* cache,
                                                 Cache::index<byFullName>::type::iterator it)
@@ -83,14 +186,12 @@ InMemoryStorage::const_iterator::operator!=(const const_iterator& rhs)
 
 InMemoryStorage::InMemoryStorage(size_t limit)
   : m_limit(limit)
-  , m_nPackets(0)
 {
   init();
 }
 
 InMemoryStorage::InMemoryStorage(boost::asio::io_service& ioService, size_t limit)
   : m_limit(limit)
-  , m_nPackets(0)
 {
   m_scheduler = make_unique<Scheduler>(ioService);
   init();
@@ -106,8 +207,25 @@ InMemoryStorage::init()
     m_capacity = m_limit;
   }
 
-  for (size_t i = 0; i < m_capacity; i++) {
-    m_freeEntries.push(new InMemoryStorageEntry());
+  allocateEntries(m_capacity);
+}
+
+void
+InMemoryStorage::allocateEntries(size_t nEntries)
+{
+  if (nEntries <= m_nAllocatedEntries) {
+    return;
+  }
+
+  size_t slabSize = nEntries - m_nAllocatedEntries;
+  m_slabs.push_back(make_unique<InMemoryStorageEntry[]>(slabSize));
+  m_nAllocatedEntries = nEntries;
+
+  // push in reverse order, so that entries are taken from the pool in address order
+  m_freeEntries.reserve(m_nAllocatedEntries);
+  InMemoryStorageEntry* slab = m_slabs.back().get();
+  for (size_t i = slabSize; i > 0; --i) {
+    m_freeEntries.push_back(&slab[i - 1]);
   }
 }
 
@@ -119,18 +237,13 @@ InMemoryStorage::~InMemoryStorage()
     it = freeEntry(it);
   }
 
-  BOOST_ASSERT(m_freeEntries.size() == m_capacity);
-
-  while (!m_freeEntries.empty()) {
-    delete m_freeEntries.top();
-    m_freeEntries.pop();
-  }
+  BOOST_ASSERT(m_freeEntries.size() == m_nAllocatedEntries);
+  BOOST_ASSERT(m_staleBuckets.empty());
 }
 
 void
 InMemoryStorage::setCapacity(size_t capacity)
 {
-  size_t oldCapacity = m_capacity;
   m_capacity = std::max(capacity, m_initCapacity);
 
   if (size() > m_capacity) {
@@ -142,29 +255,41 @@ InMemoryStorage::setCapacity(size_t capacity)
     }
   }
 
-  if (m_capacity >= oldCapacity) {
-    for (size_t i = oldCapacity; i < m_capacity; i++) {
-      m_freeEntries.push(new InMemoryStorageEntry());
-    }
-  }
-  else {
-    for (size_t i = oldCapacity; i > m_capacity; i--) {
-      delete m_freeEntries.top();
-      m_freeEntries.pop();
+  // entries beyond a reduced capacity stay in the pool, and are reused when it grows again
+  allocateEntries(m_capacity);
+
+  BOOST_ASSERT(size() + m_freeEntries.size() == m_nAllocatedEntries);
+}
+
+void
+InMemoryStorage::setByteLimit(size_t nBytes)
+{
+  m_byteLimit = nBytes;
+
+  while (m_counters.nBytes > m_byteLimit) {
+    if (!evictItem()) {
+      NDN_THROW(Error());
     }
   }
-
-  BOOST_ASSERT(size() + m_freeEntries.size() == m_capacity);
 }
 
 void
 InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
 {
+  if (!data.hasWire()) {
+    NDN_THROW(Data::Error("Cannot insert Data without wire encoding (not signed)"));
+  }
+
   // check if identical Data/Name already exists
-  auto it = m_cache.get<byFullName>().find(data.getFullName());
+  // (the implicit digest is computed only if a Data with the same name is already stored)
+  auto it = m_cache.get<byFullName>().find(data);
   if (it != m_cache.get<byFullName>().end())
     return;
 
+  size_t nBytes = InMemoryStorageEntry::computeMemoryUsage(data);
+  if (nBytes > m_byteLimit)
+    return;
+
   //if full, double the capacity
   bool doesReachLimit = (getLimit() == getCapacity());
   if (isFull() && !doesReachLimit) {
@@ -178,15 +303,23 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
     evictItem();
   }
 
+  //if the packet does not fit in the byte budget, employ replacement policy until it does
+  while (m_counters.nBytes + nBytes > m_byteLimit) {
+    if (!evictItem())
+      return;
+  }
+
   //insert to cache
   BOOST_ASSERT(m_freeEntries.size() > 0);
   // take entry for the memory pool
-  InMemoryStorageEntry* entry = m_freeEntries.top();
-  m_freeEntries.pop();
-  m_nPackets++;
+  InMemoryStorageEntry* entry = m_freeEntries.back();
+  m_freeEntries.pop_back();
   entry->setData(data);
-  if (m_scheduler != nullptr && mustBeFreshProcessingWindow > ZERO_WINDOW) {
-    entry->scheduleMarkStale(*m_scheduler, mustBeFreshProcessingWindow);
+  m_counters.nEntries++;
+  m_counters.nBytes += entry->getMemoryUsage();
+  addToPrefixIndex(data.getName());
+  if (mustBeFreshProcessingWindow > ZERO_WINDOW) {
+    scheduleMarkStale(entry, mustBeFreshProcessingWindow);
   }
   m_cache.insert(entry);
 
@@ -197,6 +330,10 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
 shared_ptr<const Data>
 InMemoryStorage::find(const Name& name)
 {
+  if ((name.empty() || !name[-1].isImplicitSha256Digest()) && !mayHaveDataUnder(name, false)) {
+    return nullptr;
+  }
+
   auto it = m_cache.get<byFullName>().lower_bound(name);
 
   // if not found, return null
@@ -205,7 +342,7 @@ InMemoryStorage::find(const Name& name)
   }
 
   // if the given name is not the prefix of the lower_bound, return null
-  if (!name.isPrefixOf((*it)->getFullName())) {
+  if (!isPrefixOfFullName(name, (*it)->getData())) {
     return nullptr;
   }
 
@@ -216,8 +353,32 @@ InMemoryStorage::find(const Name& name)
 shared_ptr<const Data>
 InMemoryStorage::find(const Interest& interest)
 {
+  const Name& name = interest.getName();
+  bool hasDigest = !name.empty() && name[-1].isImplicitSha256Digest();
+
+  if (!hasDigest) {
+    if (!mayHaveDataUnder(name, interest.getMustBeFresh())) {
+      return nullptr;
+    }
+
+    // without CanBePrefix, only Data with exactly the same name can match
+    if (!interest.getCanBePrefix()) {
+      auto range = m_cache.get<byName>().equal_range(name);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (interest.getMustBeFresh() && !(*it)->isFresh()) {
+          continue;
+        }
+        if (interest.matchesData((*it)->getData())) {
+          afterAccess(*it);
+          return (*it)->getData().shared_from_this();
+        }
+      }
+      return nullptr;
+    }
+  }
+
   // if the interest contains implicit digest, it is possible to directly locate a packet.
-  auto it = m_cache.get<byFullName>().find(interest.getName());
+  auto it = m_cache.get<byFullName>().find(name);
 
   // if a packet is located by its full name, it must be the packet to return.
   if (it != m_cache.get<byFullName>().end()) {
@@ -226,7 +387,7 @@ InMemoryStorage::find(const Interest& interest)
 
   // if the packet is not discovered by last step, either the packet is not in the storage or
   // the interest doesn't contains implicit digest.
-  it = m_cache.get<byFullName>().lower_bound(interest.getName());
+  it = m_cache.get<byFullName>().lower_bound(name);
 
   if (it == m_cache.get<byFullName>().end()) {
     return nullptr;
@@ -265,7 +426,7 @@ InMemoryStorage::selectChild(const Interest& interest,
   BOOST_ASSERT(startingPoint != m_cache.get<byFullName>().end());
 
   if (startingPoint != m_cache.get<byFullName>().begin()) {
-    BOOST_ASSERT((*startingPoint)->getFullName() < interest.getName());
+    BOOST_ASSERT(FullNameLess()(*startingPoint, interest.getName()));
   }
 
   // filter out non-fresh data
@@ -292,7 +453,7 @@ InMemoryStorage::selectChild(const Interest& interest,
 
     bool isInPrefix = false;
     if (rightmostCandidate != m_cache.get<byFullName>().end()) {
-      isInPrefix = interest.getName().isPrefixOf((*rightmostCandidate)->getFullName());
+      isInPrefix = isPrefixOfFullName(interest.getName(), (*rightmostCandidate)->getData());
     }
     if (isInPrefix) {
       if (interest.matchesData((*rightmostCandidate)->getData())) {
@@ -310,10 +471,15 @@ InMemoryStorage::selectChild(const Interest& interest,
 InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
+  removeFromPrefixIndex((*it)->getName(), (*it)->isFresh());
+  cancelMarkStale(*it);
+
+  m_counters.nEntries--;
+  m_counters.nBytes -= (*it)->getMemoryUsage();
+
   // push the *empty* entry into mem pool
   (*it)->release();
-  m_freeEntries.push(*it);
-  m_nPackets--;
+  m_freeEntries.push_back(*it);
   return m_cache.erase(it);
 }
 
@@ -338,7 +504,7 @@ InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
     freeEntry(it);
   }
 
-  if (m_freeEntries.size() > (2 * size()))
+  if (getCapacity() - size() > (2 * size()))
     setCapacity(getCapacity() / 2);
 }
 
@@ -350,6 +516,146 @@ InMemoryStorage::eraseImpl(const Name& name)
     return;
 
   freeEntry(it);
+  m_counters.nEvictions++;
+}
+
+void
+InMemoryStorage::eraseImpl(InMemoryStorageEntry* entry)
+{
+  auto it = m_cache.get<byFullName>().find(entry);
+  BOOST_ASSERT(it != m_cache.get<byFullName>().end() && *it == entry);
+
+  freeEntry(it);
+  m_counters.nEvictions++;
+}
+
+void
+InMemoryStorage::addToPrefixIndex(const Name& name)
+{
+  for (size_t hash : name.getPrefixHashes()) {
+    PrefixNode& node = m_prefixIndex[hash];
+    ++node.nEntries;
+    ++node.nFresh;
+  }
+}
+
+void
+InMemoryStorage::removeFromPrefixIndex(const Name& name, bool isFresh)
+{
+  for (size_t hash : name.getPrefixHashes()) {
+    auto it = m_prefixIndex.find(hash);
+    BOOST_ASSERT(it != m_prefixIndex.end());
+    if (isFresh) {
+      --it->second.nFresh;
+    }
+    if (--it->second.nEntries == 0) {
+      m_prefixIndex.erase(it);
+    }
+  }
+}
+
+void
+InMemoryStorage::afterMarkStale(const Name& name)
+{
+  for (size_t hash : name.getPrefixHashes()) {
+    auto it = m_prefixIndex.find(hash);
+    BOOST_ASSERT(it != m_prefixIndex.end());
+    --it->second.nFresh;
+  }
+}
+
+uint64_t
+InMemoryStorage::toStaleTick(time::steady_clock::time_point t)
+{
+  auto sinceEpoch = t.time_since_epoch();
+  return static_cast<uint64_t>((sinceEpoch + STALE_TICK - time::nanoseconds(1)) / STALE_TICK);
+}
+
+void
+InMemoryStorage::scheduleMarkStale(InMemoryStorageEntry* entry, time::nanoseconds after)
+{
+  BOOST_ASSERT(entry->m_staleIndex == std::numeric_limits<size_t>::max());
+
+  uint64_t tick = toStaleTick(time::steady_clock::now() + after);
+  bool isEarliest = m_staleBuckets.empty() || tick < m_staleBuckets.begin()->first;
+
+  // most packets are inserted with the same window, so their bucket is usually the last one
+  auto bucket = m_staleBuckets.end();
+  if (!m_staleBuckets.empty() && m_staleBuckets.rbegin()->first == tick) {
+    --bucket;
+  }
+  else {
+    bucket = m_staleBuckets.emplace_hint(bucket, tick, std::vector<InMemoryStorageEntry*>{});
+  }
+
+  entry->m_staleTick = tick;
+  entry->m_staleIndex = bucket->second.size();
+  bucket->second.push_back(entry);
+
+  if (m_scheduler != nullptr && isEarliest) {
+    auto due = time::steady_clock::time_point(tick * STALE_TICK);
+    m_staleTimer = m_scheduler->schedule(due - time::steady_clock::now(),
+                                         [this] { markStaleEntries(); });
+  }
+}
+
+void
+InMemoryStorage::cancelMarkStale(InMemoryStorageEntry* entry)
+{
+  if (entry->m_staleIndex == std::numeric_limits<size_t>::max()) {
+    return;
+  }
+
+  auto bucket = m_staleBuckets.find(entry->m_staleTick);
+  BOOST_ASSERT(bucket != m_staleBuckets.end());
+  auto& entries = bucket->second;
+  BOOST_ASSERT(entries.at(entry->m_staleIndex) == entry);
+
+  // move the last entry of the bucket into the vacated position
+  entries[entry->m_staleIndex] = entries.back();
+  entries[entry->m_staleIndex]->m_staleIndex = entry->m_staleIndex;
+  entries.pop_back();
+  entry->m_staleIndex = std::numeric_limits<size_t>::max();
+
+  // the timer is not rearmed: if it was set for this bucket, it fires without any effect
+  if (entries.empty()) {
+    m_staleBuckets.erase(bucket);
+  }
+}
+
+void
+InMemoryStorage::markStaleEntries()
+{
+  // a bucket is due once its tick has started; unlike toStaleTick(), "now" is rounded down,
+  // so that an entry is never marked as non-fresh before its processing window has elapsed
+  uint64_t now = static_cast<uint64_t>(time::steady_clock::now().time_since_epoch() / STALE_TICK);
+
+  while (!m_staleBuckets.empty() && m_staleBuckets.begin()->first <= now) {
+    auto entries = std::move(m_staleBuckets.begin()->second);
+    m_staleBuckets.erase(m_staleBuckets.begin());
+
+    for (InMemoryStorageEntry* entry : entries) {
+      entry->m_staleIndex = std::numeric_limits<size_t>::max();
+      entry->markStale();
+      afterMarkStale(entry->getName());
+    }
+  }
+
+  if (m_scheduler != nullptr && !m_staleBuckets.empty()) {
+    auto due = time::steady_clock::time_point(m_staleBuckets.begin()->first * STALE_TICK);
+    m_staleTimer = m_scheduler->schedule(due - time::steady_clock::now(),
+                                         [this] { markStaleEntries(); });
+  }
+}
+
+bool
+InMemoryStorage::mayHaveDataUnder(const Name& prefix, bool mustBeFresh) const
+{
+  auto it = m_prefixIndex.find(prefix.getHash());
+  if (it == m_prefixIndex.end()) {
+    return false;
+  }
+  return !mustBeFresh || it->second.nFresh > 0;
 }
 
 InMemoryStorage::const_iterator
@@ -23,14 +23,16 @@
 #define NDN_CXX_IMS_IN_MEMORY_STORAGE_HPP
 
 #include "ndn-cxx/ims/in-memory-storage-entry.hpp"
+#include "ndn-cxx/util/scheduler.hpp"
 
 #include <iterator>
-#include <stack>
+#include <map>
+#include <unordered_map>
 
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/mem_fun.hpp>
-#include <boost/multi_index/member.hpp>
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 
@@ -43,6 +45,33 @@ class InMemoryStorage : noncopyable
 public:
   // multi_index_container to implement storage
   class byFullName;
+  class byName;
+
+  /** @brief Orders entries by the full name of their Data, computing implicit digests lazily
+   *
+   *  The implicit digest of a stored Data is computed only when the order cannot be decided
+   *  otherwise, i.e., when it is compared with a different Data packet with the same name, or
+   *  with a name that has an implicit digest component right after the name of the Data.
+   *  Entries can also be compared with a Name, or with a Data that has not been inserted yet.
+   */
+  class FullNameLess
+  {
+  public:
+    bool
+    operator()(const InMemoryStorageEntry* lhs, const InMemoryStorageEntry* rhs) const;
+
+    bool
+    operator()(const InMemoryStorageEntry* lhs, const Name& rhs) const;
+
+    bool
+    operator()(const Name& lhs, const InMemoryStorageEntry* rhs) const;
+
+    bool
+    operator()(const InMemoryStorageEntry* lhs, const Data& rhs) const;
+
+    bool
+    operator()(const Data& lhs, const InMemoryStorageEntry* rhs) const;
+  };
 
   typedef boost::multi_index_container<
     InMemoryStorageEntry*,
@@ -51,9 +80,16 @@ public:
       // by Full Name
       boost::multi_index::ordered_unique<
         boost::multi_index::tag<byFullName>,
+        boost::multi_index::identity<InMemoryStorageEntry*>,
+        FullNameLess
+      >,
+
+      // by Name, for exact match
+      boost::multi_index::hashed_non_unique<
+        boost::multi_index::tag<byName>,
         boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
-                                          &InMemoryStorageEntry::getFullName>,
-        std::less<Name>
+                                          &InMemoryStorageEntry::getName>,
+        std::hash<Name>
       >
 
     >
@@ -111,8 +147,18 @@ public:
     }
   };
 
+  /** @brief Represents the statistics of the in-memory storage
+   */
+  struct Counters
+  {
+    size_t nEntries = 0;     ///< number of stored packets
+    size_t nBytes = 0;       ///< sum of InMemoryStorageEntry::getMemoryUsage() of stored packets
+    uint64_t nEvictions = 0; ///< number of packets evicted by the replacement policy
+  };
+
   /** @brief Create a InMemoryStorage with up to @p limit entries
-   *  The InMemoryStorage created through this method will ignore MustBeFresh in interest processing
+   *  The InMemoryStorage created through this method will ignore MustBeFresh in interest processing,
+   *  unless markStaleEntries() is invoked
    */
   explicit
   InMemoryStorage(size_t limit = std::numeric_limits<size_t>::max());
@@ -135,17 +181,27 @@ public:
    *  @param data the packet to insert, must be signed and have wire encoding
    *  @param mustBeFreshProcessingWindow Beyond this time period after the data is inserted, the
    *         data can only be used to answer interest without MustBeFresh selector.
+   *         Packets are marked as non-fresh in batches, up to STALE_TICK after this period.
    *
    *  @note Packets are considered duplicate if the name with implicit digest matches.
    *  The new Data packet with the identical name, but a different payload
    *  will be placed in the in-memory storage.
    *
+   *  @note If the memory accounted to the new packet would exceed the byte limit, packets are
+   *  evicted according to the replacement policy until it fits. The new packet is not inserted
+   *  if it is larger than the byte limit, or if the replacement policy cannot evict enough packets.
+   *
    *  @note It will invoke afterInsert(shared_ptr<InMemoryStorageEntry>).
    */
   void
   insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow = INFINITE_WINDOW);
 
   /** @brief Finds the best match Data for an Interest
+   *
+   *  An Interest without CanBePrefix is answered through a hash index on the Data name. If
+   *  packets with the same name but different digests exist, any of them that satisfies the
+   *  Interest may be returned. An Interest with CanBePrefix is first checked against the prefix
+   *  index, so that a lookup under a prefix without any (fresh) Data returns immediately.
    *
    *  @note It will invoke afterAccess(shared_ptr<InMemoryStorageEntry>).
    *  As currently it is impossible to determine whether a Name contains implicit digest or not,
@@ -172,6 +228,15 @@ public:
   shared_ptr<const Data>
   find(const Name& name);
 
+  /** @brief Marks packets whose MustBeFresh processing window has elapsed as non-fresh
+   *
+   *  An InMemoryStorage created with an io_service does this on its own, every STALE_TICK.
+   *  An InMemoryStorage created without one may invoke this before lookups instead; this is
+   *  cheap when no processing window has elapsed since the last invocation.
+   */
+  void
+  markStaleEntries();
+
   /** @brief Deletes in-memory storage entry by prefix by default.
    *  @param prefix Exact name of a prefix of the data to remove
    *  @param isPrefix If false, the function will only delete the
@@ -198,7 +263,33 @@ public:
   size_t
   size() const
   {
-    return m_nPackets;
+    return m_counters.nEntries;
+  }
+
+  /** @brief Sets the maximum memory, in bytes, accounted to stored packets
+   *
+   *  If the current usage exceeds the new limit, packets are evicted according to the
+   *  replacement policy until it does not.
+   *  @throw Error the replacement policy cannot evict enough packets
+   *  @sa InMemoryStorageEntry::getMemoryUsage()
+   */
+  void
+  setByteLimit(size_t nBytes);
+
+  /** @return{ maximum memory, in bytes, accounted to stored packets }
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_byteLimit;
+  }
+
+  /** @brief Returns the statistics of the in-memory storage
+   */
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
   }
 
   /** @brief Returns begin iterator of the in-memory storage ordering by
@@ -280,6 +371,14 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   void
   eraseImpl(const Name& name);
 
+  /** @brief deletes an in-memory storage entry that is being evicted.
+   *
+   *  Unlike eraseImpl(const Name&), this does not need the full name of the entry.
+   *  It won't invoke beforeErase(shared_ptr<Entry>).
+   */
+  void
+  eraseImpl(InMemoryStorageEntry* entry);
+
   /** @brief Prints contents of the in-memory storage
    */
   void
@@ -322,12 +421,67 @@ private:
   void
   init();
 
+  /** @brief Grows the memory pool to @p nEntries entries, allocating them in a single slab
+   */
+  void
+  allocateEntries(size_t nEntries);
+
+  /** @brief Adds a newly inserted fresh entry to the prefix index
+   */
+  void
+  addToPrefixIndex(const Name& name);
+
+  /** @brief Removes an entry from the prefix index
+   */
+  void
+  removeFromPrefixIndex(const Name& name, bool isFresh);
+
+  /** @brief Updates the prefix index after an entry has been marked as non-fresh
+   */
+  void
+  afterMarkStale(const Name& name);
+
+  /** @brief Schedules @p entry to be marked as non-fresh after @p after, rounded up to STALE_TICK
+   */
+  void
+  scheduleMarkStale(InMemoryStorageEntry* entry, time::nanoseconds after);
+
+  /** @brief Removes @p entry from the expiry buckets, if it is scheduled to be marked as non-fresh
+   */
+  void
+  cancelMarkStale(InMemoryStorageEntry* entry);
+
+  /** @brief Returns the index of the expiry bucket of @p t, i.e., @p t in units of STALE_TICK
+   *         rounded up
+   */
+  static uint64_t
+  toStaleTick(time::steady_clock::time_point t);
+
+  /** @brief Checks the prefix index for Data that may match @p prefix
+   *  @return false if no Data (or no fresh Data, if @p mustBeFresh) is stored under @p prefix;
+   *          true otherwise, including on hash collisions
+   */
+  bool
+  mayHaveDataUnder(const Name& prefix, bool mustBeFresh) const;
+
+  /** @brief Number of entries, and of fresh entries, stored under a name prefix
+   */
+  struct PrefixNode
+  {
+    size_t nEntries = 0;
+    size_t nFresh = 0;
+  };
+
 public:
   static const time::milliseconds INFINITE_WINDOW;
+  /// granularity at which packets are marked as non-fresh
+  static const time::milliseconds STALE_TICK;
 
 private:
   static const time::milliseconds ZERO_WINDOW;
 
+  friend class InMemoryStorageSharded;
+
 private:
   Cache m_cache;
   /// user defined maximum capacity of the in-memory storage in packets
@@ -336,12 +490,24 @@ private:
   const size_t m_initCapacity = 16;
   /// current capacity of the in-memory storage in packets
   size_t m_capacity;
-  /// current number of packets in in-memory storage
-  size_t m_nPackets;
+  /// user defined maximum memory accounted to stored packets
+  size_t m_byteLimit = std::numeric_limits<size_t>::max();
+  /// current number of packets and bytes, and evictions
+  Counters m_counters;
+  /// entries are allocated in contiguous slabs, which are released with the in-memory storage
+  std::vector<std::unique_ptr<InMemoryStorageEntry[]>> m_slabs;
+  /// number of entries in all slabs
+  size_t m_nAllocatedEntries = 0;
   /// memory pool
-  std::stack<InMemoryStorageEntry*> m_freeEntries;
+  std::vector<InMemoryStorageEntry*> m_freeEntries;
+  /// name trie flattened by prefix hash (see Name::getPrefixHashes), used to reject lookups early
+  std::unordered_map<size_t, PrefixNode> m_prefixIndex;
   /// scheduler
   unique_ptr<Scheduler> m_scheduler;
+  /// entries to be marked as non-fresh, by expiry time in units of STALE_TICK
+  std::map<uint64_t, std::vector<InMemoryStorageEntry*>> m_staleBuckets;
+  /// fires when the earliest expiry bucket is due
+  scheduler::ScopedEventId m_staleTimer;
 };
 
 } // namespace ndn
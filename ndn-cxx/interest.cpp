@@ -22,13 +22,14 @@
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
-#include "ndn-cxx/security/transform/digest-filter.hpp"
-#include "ndn-cxx/security/transform/step-source.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/encoding/encoding-arena.hpp"
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
 #include "ndn-cxx/util/random.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <array>
 #include <cstring>
 #include <sstream>
 
@@ -141,13 +142,10 @@ Interest::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
+  EncodingArena arena;
+  wireEncode(arena.encoder());
 
-  EncodingBuffer encoder(estimatedSize, 0);
-  wireEncode(encoder);
-
-  const_cast<Interest*>(this)->wireDecode(encoder.block());
+  const_cast<Interest*>(this)->wireDecode(arena.block());
   return m_wire;
 }
 
@@ -689,27 +687,35 @@ Interest::isParametersDigestValid() const
   }
 
   const auto& digestComponent = getName()[digestIndex];
-  auto digest = computeParametersDigest();
+  std::array<uint8_t, util::Sha256::DIGEST_SIZE> digest;
+  if (!computeParametersDigest(digest)) {
+    return false;
+  }
 
   return std::equal(digestComponent.value_begin(), digestComponent.value_end(),
-                    digest->begin(), digest->end());
+                    digest.begin(), digest.end());
 }
 
-shared_ptr<Buffer>
-Interest::computeParametersDigest() const
+bool
+Interest::computeParametersDigest(span<uint8_t> digest) const
 {
-  using namespace security::transform;
-
-  StepSource in;
-  OBufferStream out;
-  in >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(out);
-
+  InputBuffers bufs;
+  bufs.reserve(m_parameters.size());
   for (const auto& block : m_parameters) {
-    in.write({block.wire(), block.size()});
+    bufs.emplace_back(block.wire(), block.size());
   }
-  in.end();
+  return security::detail::EvpCrypto::digest(DigestAlgorithm::SHA256, bufs, digest) ==
+         util::Sha256::DIGEST_SIZE;
+}
 
-  return out.buf();
+shared_ptr<Buffer>
+Interest::computeParametersDigest() const
+{
+  auto digest = make_shared<Buffer>(util::Sha256::DIGEST_SIZE);
+  if (!computeParametersDigest(*digest)) {
+    NDN_THROW(Error("Failed to compute the digest of ApplicationParameters"));
+  }
+  return digest;
 }
 
 void
@@ -466,6 +466,12 @@ private:
   NDN_CXX_NODISCARD shared_ptr<Buffer>
   computeParametersDigest() const;
 
+  /** @brief Compute the SHA-256 digest of ApplicationParameters into @p digest
+   *  @return whether the digest was computed
+   */
+  NDN_CXX_NODISCARD bool
+  computeParametersDigest(span<uint8_t> digest) const;
+
   /** @brief Append a ParametersSha256DigestComponent to the Interest's name
    *         or update the digest value in the existing component.
    *
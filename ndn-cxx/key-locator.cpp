@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/key-locator.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/encoding-arena.hpp"
 #include "ndn-cxx/util/overload.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 
@@ -76,13 +77,10 @@ KeyLocator::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
+  EncodingArena arena;
+  wireEncode(arena.encoder());
 
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = arena.block();
   return m_wire;
 }
 
@@ -119,10 +119,11 @@ Block
 Packet::wireEncode() const
 {
   // If no header or trailer, return bare network packet
-  Block::element_container elements = m_wire.elements();
+  const auto& elements = m_wire.elements();
   if (elements.size() == 1 && elements.front().type() == FragmentField::TlvType::value) {
-    elements.front().parse();
-    return elements.front().elements().front();
+    const Block& fragment = elements.front();
+    fragment.parse();
+    return fragment.elements().front();
   }
 
   m_wire.encode();
@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/meta-info.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/encoding-arena.hpp"
 
 #include <boost/range/adaptor/reversed.hpp>
 
@@ -167,13 +168,10 @@ MetaInfo::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
+  EncodingArena arena;
+  wireEncode(arena.encoder());
 
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = arena.block();
   return m_wire;
 }
 
@@ -178,6 +178,8 @@ Controller::processDatasetFetchError(const DatasetFailCallback& onFailure,
       break;
     case SegmentFetcher::ErrorCode::DATA_HAS_NO_SEGMENT:
     case SegmentFetcher::ErrorCode::FINALBLOCKID_NOT_SEGMENT:
+    case SegmentFetcher::ErrorCode::SEGMENT_SIZE_MISMATCH:
+    case SegmentFetcher::ErrorCode::WRITE_ERROR: // not expected, datasets are not fetched in 'file' mode
       onFailure(ERROR_SERVER, msg);
       break;
     case SegmentFetcher::ErrorCode::SEGMENT_VALIDATION_FAIL:
@@ -26,10 +26,12 @@
 #include "ndn-cxx/name-component.hpp"
 #include "ndn-cxx/impl/name-component-types.hpp"
 
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <sstream>
 
+#include <boost/endian/conversion.hpp>
 #include <boost/logic/tribool.hpp>
 
 namespace ndn {
@@ -42,6 +44,158 @@ BOOST_CONCEPT_ASSERT((WireDecodable<Component>));
 static_assert(std::is_base_of<tlv::Error, Component::Error>::value,
               "name::Component::Error must inherit from tlv::Error");
 
+namespace {
+
+/**
+ * @brief Thread-local bump allocator for the wire encoding of small name components.
+ *
+ * Components are encoded back-to-back into a shared chunk, so that creating a component does
+ * not normally allocate memory. Encoded octets are never modified afterwards, therefore such
+ * components can be copied and shared across threads like any other Block. A chunk is released
+ * together with the last component referring to it; Name::wireEncode() copies the components
+ * into the name's own buffer, so encoded names do not keep chunks alive.
+ *
+ * Chunks are kept small, so that a long-lived component created among short-lived ones pins
+ * at most CHUNK_SIZE octets, which is only a few times the overhead of a Buffer of its own.
+ * A chunk that is no longer referred to by any component is reused in place.
+ */
+class ComponentArena
+{
+public:
+  /**
+   * @brief Encode a NameComponent with TLV-TYPE @p type and a TLV-VALUE of @p valueSize octets.
+   * @param writeValue function that writes exactly @p valueSize octets at the given position
+   */
+  template<typename WriteValue>
+  static Block
+  encode(uint32_t type, size_t valueSize, const WriteValue& writeValue)
+  {
+    size_t headerSize = tlv::sizeOfVarNumber(type) + tlv::sizeOfVarNumber(valueSize);
+    size_t totalSize = headerSize + valueSize;
+
+    shared_ptr<Buffer> buffer;
+    size_t offset = 0;
+    if (totalSize > MAX_COMPONENT_SIZE) {
+      buffer = std::make_shared<Buffer>(totalSize);
+    }
+    else {
+      ComponentArena& arena = getThreadArena();
+      if (arena.m_chunk == nullptr || arena.m_used + totalSize > CHUNK_SIZE) {
+        if (arena.m_chunk == nullptr || arena.m_chunk.use_count() > 1) {
+          arena.m_chunk = std::make_shared<Buffer>(CHUNK_SIZE);
+        }
+        else {
+          // the last component may have been released by another thread
+          std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        arena.m_used = 0;
+      }
+      buffer = arena.m_chunk;
+      offset = arena.m_used;
+      arena.m_used += totalSize;
+    }
+
+    uint8_t* pos = buffer->data() + offset;
+    pos = writeVarNumber(pos, type);
+    pos = writeVarNumber(pos, valueSize);
+    writeValue(pos);
+
+    auto begin = buffer->cbegin() + offset;
+    auto valueBegin = begin + headerSize;
+    auto end = valueBegin + valueSize;
+    return Block(std::move(buffer), type, begin, end, valueBegin, end);
+  }
+
+  static uint8_t*
+  writeVarNumber(uint8_t* pos, uint64_t number)
+  {
+    if (number < 253) {
+      *pos = static_cast<uint8_t>(number);
+      return pos + 1;
+    }
+    else if (number <= std::numeric_limits<uint16_t>::max()) {
+      *pos = 253;
+      return writeBigEndian(pos + 1, static_cast<uint16_t>(number));
+    }
+    else if (number <= std::numeric_limits<uint32_t>::max()) {
+      *pos = 254;
+      return writeBigEndian(pos + 1, static_cast<uint32_t>(number));
+    }
+    else {
+      *pos = 255;
+      return writeBigEndian(pos + 1, number);
+    }
+  }
+
+  static uint8_t*
+  writeNonNegativeInteger(uint8_t* pos, uint64_t integer)
+  {
+    if (integer <= std::numeric_limits<uint8_t>::max()) {
+      *pos = static_cast<uint8_t>(integer);
+      return pos + 1;
+    }
+    else if (integer <= std::numeric_limits<uint16_t>::max()) {
+      return writeBigEndian(pos, static_cast<uint16_t>(integer));
+    }
+    else if (integer <= std::numeric_limits<uint32_t>::max()) {
+      return writeBigEndian(pos, static_cast<uint32_t>(integer));
+    }
+    else {
+      return writeBigEndian(pos, integer);
+    }
+  }
+
+private:
+  /**
+   * @brief Returns the arena of the calling thread.
+   * @note Not a local of encode(), which would give each of its instantiations an arena of its own.
+   */
+  static ComponentArena&
+  getThreadArena()
+  {
+    thread_local ComponentArena arena;
+    return arena;
+  }
+
+  template<typename T>
+  static uint8_t*
+  writeBigEndian(uint8_t* pos, T number)
+  {
+    number = boost::endian::native_to_big(number);
+    std::memcpy(pos, &number, sizeof(number));
+    return pos + sizeof(number);
+  }
+
+private:
+  static constexpr size_t CHUNK_SIZE = 256;
+  static constexpr size_t MAX_COMPONENT_SIZE = 64;
+
+  shared_ptr<Buffer> m_chunk;
+  size_t m_used = 0;
+};
+
+constexpr size_t ComponentArena::CHUNK_SIZE;
+constexpr size_t ComponentArena::MAX_COMPONENT_SIZE;
+
+Block
+encodeComponent(uint32_t type, span<const uint8_t> value)
+{
+  return ComponentArena::encode(type, value.size(), [value] (uint8_t* pos) {
+    std::copy(value.begin(), value.end(), pos);
+  });
+}
+
+Block
+encodeNumberComponent(uint32_t type, uint64_t number)
+{
+  size_t valueSize = tlv::sizeOfNonNegativeInteger(number);
+  return ComponentArena::encode(type, valueSize, [number] (uint8_t* pos) {
+    ComponentArena::writeNonNegativeInteger(pos, number);
+  });
+}
+
+} // namespace
+
 static Convention g_conventionEncoding = Convention::TYPED;
 static Convention g_conventionDecoding = Convention::EITHER;
 
@@ -144,18 +298,21 @@ Component::Component(uint32_t type, ConstBufferPtr buffer)
 }
 
 Component::Component(uint32_t type, span<const uint8_t> value)
-  : Block(makeBinaryBlock(type, value))
+  : Block(encodeComponent(type, value))
 {
   ensureValid();
 }
 
 Component::Component(const char* str)
-  : Block(makeBinaryBlock(tlv::GenericNameComponent, str, std::char_traits<char>::length(str)))
+  : Block(encodeComponent(tlv::GenericNameComponent,
+                          {reinterpret_cast<const uint8_t*>(str),
+                           std::char_traits<char>::length(str)}))
 {
 }
 
 Component::Component(const std::string& str)
-  : Block(makeStringBlock(tlv::GenericNameComponent, str))
+  : Block(encodeComponent(tlv::GenericNameComponent,
+                          {reinterpret_cast<const uint8_t*>(str.data()), str.size()}))
 {
 }
 
@@ -359,26 +516,17 @@ Component::toSequenceNumber() const
 Component
 Component::fromNumber(uint64_t number, uint32_t type)
 {
-  return makeNonNegativeIntegerBlock(type, number);
+  return encodeNumberComponent(type, number);
 }
 
 Component
 Component::fromNumberWithMarker(uint8_t marker, uint64_t number)
 {
-  EncodingEstimator estimator;
-  size_t valueLength = estimator.prependNonNegativeInteger(number);
-  valueLength += estimator.prependBytes({marker});
-  size_t totalLength = valueLength;
-  totalLength += estimator.prependVarNumber(valueLength);
-  totalLength += estimator.prependVarNumber(tlv::GenericNameComponent);
-
-  EncodingBuffer encoder(totalLength, 0);
-  encoder.prependNonNegativeInteger(number);
-  encoder.prependBytes({marker});
-  encoder.prependVarNumber(valueLength);
-  encoder.prependVarNumber(tlv::GenericNameComponent);
-
-  return encoder.block();
+  size_t valueSize = 1 + tlv::sizeOfNonNegativeInteger(number);
+  return ComponentArena::encode(tlv::GenericNameComponent, valueSize, [=] (uint8_t* pos) {
+    *pos = marker;
+    ComponentArena::writeNonNegativeInteger(pos + 1, number);
+  });
 }
 
 Component
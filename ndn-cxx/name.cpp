@@ -25,11 +25,13 @@
 
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/encoding-arena.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/impl/name-prefix-hash.hpp"
 #include "ndn-cxx/util/time.hpp"
 
+#include <algorithm>
 #include <sstream>
-#include <boost/functional/hash.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/concepts.hpp>
 
@@ -48,6 +50,22 @@ static_assert(std::is_base_of<tlv::Error, Name::Error>::value,
               "Name::Error must inherit from tlv::Error");
 
 const size_t Name::npos = std::numeric_limits<size_t>::max();
+constexpr size_t Name::INITIAL_CAPACITY;
+
+namespace detail {
+
+/** @brief Hashes of all prefixes of a Name, shared by the copies of the name
+ *
+ *  An instance is immutable once published by Name::getHashes(), and is released together with
+ *  the last Name referring to it.
+ */
+struct NameHashes : noncopyable
+{
+  std::atomic<size_t> nRefs{1};
+  std::vector<size_t> prefixHashes;
+};
+
+} // namespace detail
 
 // ---- constructors, encoding, decoding ----
 
@@ -99,6 +117,9 @@ Name::Name(std::string uri)
     }
   }
 
+  if (!uri.empty()) {
+    reserve(static_cast<size_t>(std::count(uri.begin(), uri.end(), '/')) + 1);
+  }
   size_t iComponentStart = 0;
 
   // Unescape the components.
@@ -112,6 +133,44 @@ Name::Name(std::string uri)
   }
 }
 
+Name::Name(const Name& other)
+  : m_wire(other.m_wire)
+  , m_hashes(other.shareHashes())
+{
+}
+
+Name::Name(Name&& other) noexcept
+  : m_wire(std::move(other.m_wire))
+  , m_hashes(other.m_hashes.exchange(nullptr, std::memory_order_relaxed))
+{
+}
+
+Name&
+Name::operator=(const Name& other)
+{
+  if (this != &other) {
+    m_wire = other.m_wire;
+    releaseHashes(m_hashes.exchange(other.shareHashes(), std::memory_order_relaxed));
+  }
+  return *this;
+}
+
+Name&
+Name::operator=(Name&& other) noexcept
+{
+  if (this != &other) {
+    m_wire = std::move(other.m_wire);
+    releaseHashes(m_hashes.exchange(other.m_hashes.exchange(nullptr, std::memory_order_relaxed),
+                                    std::memory_order_relaxed));
+  }
+  return *this;
+}
+
+Name::~Name()
+{
+  releaseHashes(m_hashes.load(std::memory_order_relaxed));
+}
+
 template<encoding::Tag TAG>
 size_t
 Name::wireEncode(EncodingImpl<TAG>& encoder) const
@@ -134,13 +193,10 @@ Name::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
+  EncodingArena arena;
+  wireEncode(arena.encoder());
 
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = arena.block();
   m_wire.parse();
 
   return m_wire;
@@ -154,6 +210,7 @@ Name::wireDecode(const Block& wire)
 
   m_wire = wire;
   m_wire.parse();
+  resetHashes();
 }
 
 Name
@@ -194,6 +251,7 @@ Name::getSubName(ssize_t iStartComponent, size_t nComponents) const
   if (nComponents != npos)
     iEnd = std::min(size(), iStart + nComponents);
 
+  result.reserve(iEnd > iStart ? iEnd - iStart : 0);
   for (size_t i = iStart; i < iEnd; ++i)
     result.append(at(i));
 
@@ -211,6 +269,7 @@ Name::set(ssize_t i, const Component& component)
 
   const_cast<Block::element_container&>(m_wire.elements())[i] = component;
   m_wire.resetWire();
+  resetHashes();
   return *this;
 }
 
@@ -223,6 +282,7 @@ Name::set(ssize_t i, Component&& component)
 
   const_cast<Block::element_container&>(m_wire.elements())[i] = std::move(component);
   m_wire.resetWire();
+  resetHashes();
   return *this;
 }
 
@@ -274,12 +334,14 @@ Name::erase(ssize_t i)
   }
 
   m_wire.erase(m_wire.elements_begin() + i);
+  resetHashes();
 }
 
 void
 Name::clear()
 {
   m_wire = Block(tlv::Name);
+  resetHashes();
 }
 
 // ---- algorithms ----
@@ -317,6 +379,17 @@ Name::equals(const Name& other) const
   if (size() != other.size())
     return false;
 
+  // only use the hashes that are already known: names sharing them are copies of each other,
+  // and names with different hashes cannot be equal
+  const auto* hashes = m_hashes.load(std::memory_order_acquire);
+  const auto* otherHashes = other.m_hashes.load(std::memory_order_acquire);
+  if (hashes != nullptr && otherHashes != nullptr) {
+    if (hashes == otherHashes)
+      return true;
+    if (hashes->prefixHashes.back() != otherHashes->prefixHashes.back())
+      return false;
+  }
+
   for (size_t i = 0; i < size(); ++i) {
     if (get(i) != other.get(i))
       return false;
@@ -325,6 +398,60 @@ Name::equals(const Name& other) const
   return true;
 }
 
+size_t
+Name::getHash() const
+{
+  return getHashes().prefixHashes.back();
+}
+
+const std::vector<size_t>&
+Name::getPrefixHashes() const
+{
+  return getHashes().prefixHashes;
+}
+
+const detail::NameHashes&
+Name::getHashes() const
+{
+  auto* hashes = m_hashes.load(std::memory_order_acquire);
+  if (hashes != nullptr) {
+    return *hashes;
+  }
+
+  auto computed = make_unique<detail::NameHashes>();
+  computed->prefixHashes.reserve(size() + 1);
+  detail::NamePrefixHasher hasher;
+  computed->prefixHashes.push_back(hasher.get());
+  for (const Component& component : *this) {
+    computed->prefixHashes.push_back(hasher.append(component).get());
+  }
+
+  // publish the complete hashes, unless another thread has already published its own
+  if (m_hashes.compare_exchange_strong(hashes, computed.get(),
+                                       std::memory_order_acq_rel, std::memory_order_acquire)) {
+    return *computed.release();
+  }
+  return *hashes;
+}
+
+detail::NameHashes*
+Name::shareHashes() const noexcept
+{
+  auto* hashes = m_hashes.load(std::memory_order_acquire);
+  if (hashes != nullptr) {
+    hashes->nRefs.fetch_add(1, std::memory_order_relaxed);
+  }
+  return hashes;
+}
+
+void
+Name::releaseHashes(detail::NameHashes* hashes) noexcept
+{
+  if (hashes != nullptr && hashes->nRefs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete hashes;
+  }
+}
+
 int
 Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t count2) const
 {
@@ -383,8 +510,7 @@ namespace std {
 size_t
 hash<ndn::Name>::operator()(const ndn::Name& name) const
 {
-  return boost::hash_range(name.wireEncode().wire(),
-                           name.wireEncode().wire() + name.wireEncode().size());
+  return name.getHash();
 }
 
 } // namespace std
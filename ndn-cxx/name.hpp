@@ -29,12 +29,18 @@
 #include "ndn-cxx/name-component.hpp"
 #include "ndn-cxx/util/optional.hpp"
 
+#include <atomic>
 #include <iterator>
+#include <vector>
 
 namespace ndn {
 
 class Name;
 
+namespace detail {
+struct NameHashes;
+} // namespace detail
+
 /** @brief Represents an arbitrary sequence of name components
  */
 using PartialName = Name;
@@ -94,6 +100,18 @@ public: // constructors, encoding, decoding
    */
   Name(std::string uri);
 
+  Name(const Name& other);
+
+  Name(Name&& other) noexcept;
+
+  Name&
+  operator=(const Name& other);
+
+  Name&
+  operator=(Name&& other) noexcept;
+
+  ~Name();
+
   /** @brief Write URI representation of the name to the output stream
    *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/name.html#ndn-uri-scheme
    */
@@ -278,6 +296,8 @@ public: // modifiers
   Name&
   append(const Component& component)
   {
+    reserveOnFirstAppend();
+    resetHashes();
     m_wire.push_back(component);
     return *this;
   }
@@ -288,6 +308,8 @@ public: // modifiers
   Name&
   append(Component&& component)
   {
+    reserveOnFirstAppend();
+    resetHashes();
     m_wire.push_back(std::move(component));
     return *this;
   }
@@ -361,6 +383,8 @@ public: // modifiers
   Name&
   append(Block value)
   {
+    reserveOnFirstAppend();
+    resetHashes();
     if (value.type() == tlv::GenericNameComponent) {
       m_wire.push_back(std::move(value));
     }
@@ -578,6 +602,26 @@ public: // algorithms
   bool
   equals(const Name& other) const;
 
+  /** @brief Return a hash value of this name
+   *
+   *  The hash is computed on first use and cached until the name is modified. Equal names have
+   *  equal hashes, regardless of how their wire encoding was obtained. The cache is published
+   *  atomically and shared by copies of the name, so this can be invoked concurrently on the
+   *  same Name, as long as it is not modified.
+   */
+  size_t
+  getHash() const;
+
+  /** @brief Return the hash values of all prefixes of this name
+   *
+   *  Element @c i of the returned vector is the hash of `getPrefix(i)`, for `0 <= i <= size()`;
+   *  in particular, the last element equals getHash(). These allow longest prefix match to probe
+   *  a hash table once per prefix length, instead of walking an ordered container.
+   *  The vector is computed on first use and cached until the name is modified, like getHash().
+   */
+  const std::vector<size_t>&
+  getPrefixHashes() const;
+
   /** @brief Compare this to the other Name using NDN canonical ordering.
    *
    *  If the first components of each name are not equal, this returns a negative value if
@@ -670,7 +714,51 @@ public:
   static const size_t npos;
 
 private:
+  /** @brief Reserve room for the components of a typical name before the first one is appended,
+   *         so that building a name one component at a time does not keep reallocating.
+   */
+  void
+  reserveOnFirstAppend()
+  {
+    if (m_wire.elements().capacity() == 0) {
+      reserve(INITIAL_CAPACITY);
+    }
+  }
+
+  void
+  reserve(size_t nComponents)
+  {
+    m_wire.reserveElements(nComponents);
+  }
+
+  /** @brief Return the cached hashes, computing and publishing them if necessary
+   */
+  const detail::NameHashes&
+  getHashes() const;
+
+  /** @brief Return the cached hashes with an additional reference, or nullptr if not computed
+   */
+  detail::NameHashes*
+  shareHashes() const noexcept;
+
+  static void
+  releaseHashes(detail::NameHashes* hashes) noexcept;
+
+  /** @brief Invalidate the cached hashes, must be invoked whenever the components change
+   */
+  void
+  resetHashes() noexcept
+  {
+    if (m_hashes.load(std::memory_order_relaxed) != nullptr) {
+      releaseHashes(m_hashes.exchange(nullptr, std::memory_order_relaxed));
+    }
+  }
+
+private:
+  static constexpr size_t INITIAL_CAPACITY = 8;
+
   mutable Block m_wire;
+  mutable std::atomic<detail::NameHashes*> m_hashes{nullptr};
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(Name);
@@ -68,6 +68,7 @@ void
 CertificateStorage::resetAnchors()
 {
   m_trustAnchors.clear();
+  m_publicKeyCache.clear();
 }
 
 void
@@ -80,6 +81,7 @@ void
 CertificateStorage::resetVerifiedCerts()
 {
   m_verifiedCertCache.clear();
+  m_publicKeyCache.clear();
 }
 
 void
@@ -106,6 +108,12 @@ CertificateStorage::getUnverifiedCertCache() const
   return m_unverifiedCertCache;
 }
 
+const PublicKeyCache&
+CertificateStorage::getPublicKeyCache() const
+{
+  return m_publicKeyCache;
+}
+
 } // inline namespace v2
 } // namespace security
 } // namespace ndn
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/security/certificate.hpp"
 #include "ndn-cxx/security/certificate-cache.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
 #include "ndn-cxx/security/trust-anchor-container.hpp"
 
 namespace ndn {
@@ -82,6 +83,12 @@ public:
   const CertificateCache&
   getUnverifiedCertCache() const;
 
+  /**
+   * @return Cache of parsed public keys of trust anchors and verified certificates
+   */
+  const PublicKeyCache&
+  getPublicKeyCache() const;
+
 protected:
   /**
    * @brief load static trust anchor.
@@ -134,6 +141,7 @@ protected:
   TrustAnchorContainer m_trustAnchors;
   CertificateCache m_verifiedCertCache;
   CertificateCache m_unverifiedCertCache;
+  PublicKeyCache m_publicKeyCache;
 };
 
 } // inline namespace v2
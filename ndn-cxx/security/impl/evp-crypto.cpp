@@ -0,0 +1,232 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
+#include "ndn-cxx/security/impl/openssl-helper.hpp"
+#include "ndn-cxx/security/transform/private-key.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/util/scope.hpp"
+
+#include <array>
+
+namespace ndn {
+namespace security {
+namespace detail {
+
+constexpr size_t EvpCrypto::MAX_DIGEST_SIZE;
+
+static const EVP_MD*
+getEvpMd(DigestAlgorithm algo)
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  // OpenSSL 3 looks up the provider implementation of a built-in EVP_MD upon every
+  // initialization, unless the EVP_MD was explicitly fetched beforehand
+  static const auto fetchedMds = [] {
+    std::array<EVP_MD*, static_cast<size_t>(DigestAlgorithm::SM3) + 1> mds{};
+    for (size_t i = 0; i < mds.size(); ++i) {
+      const EVP_MD* md = digestAlgorithmToEvpMd(static_cast<DigestAlgorithm>(i));
+      if (md != nullptr) {
+        mds[i] = EVP_MD_fetch(nullptr, EVP_MD_get0_name(md), nullptr);
+      }
+    }
+    return mds;
+  }();
+
+  auto index = static_cast<size_t>(algo);
+  if (index < fetchedMds.size() && fetchedMds[index] != nullptr) {
+    return fetchedMds[index];
+  }
+#endif // OPENSSL_VERSION_NUMBER >= 0x30000000L
+  return digestAlgorithmToEvpMd(algo);
+}
+
+template<typename Iterator>
+static size_t
+computeDigest(DigestAlgorithm algo, Iterator first, Iterator last, span<uint8_t> digest)
+{
+  const EVP_MD* md = getEvpMd(algo);
+  if (md == nullptr || digest.size() < static_cast<size_t>(EVP_MD_size(md))) {
+    return 0;
+  }
+
+  // the context is reused by all digest computations of a thread
+  thread_local EvpMdCtx ctx;
+  if (EVP_DigestInit_ex(ctx, md, nullptr) != 1) {
+    return 0;
+  }
+  for (auto it = first; it != last; ++it) {
+    if (EVP_DigestUpdate(ctx, it->data(), it->size()) != 1) {
+      return 0;
+    }
+  }
+
+  unsigned int digestSize = 0;
+  if (EVP_DigestFinal_ex(ctx, digest.data(), &digestSize) != 1) {
+    return 0;
+  }
+  return digestSize;
+}
+
+size_t
+EvpCrypto::digest(DigestAlgorithm algo, const InputBuffers& bufs, span<uint8_t> digest) noexcept
+{
+  try {
+    return computeDigest(algo, bufs.begin(), bufs.end(), digest);
+  }
+  catch (const std::exception&) {
+    return 0;
+  }
+}
+
+size_t
+EvpCrypto::digest(DigestAlgorithm algo, span<const uint8_t> buf, span<uint8_t> digest) noexcept
+{
+  try {
+    return computeDigest(algo, &buf, &buf + 1, digest);
+  }
+  catch (const std::exception&) {
+    return 0;
+  }
+}
+
+size_t
+EvpCrypto::getMaxSignatureSize(const transform::PrivateKey& key) noexcept
+{
+  auto pkey = reinterpret_cast<EVP_PKEY*>(key.getEvpPkey());
+  if (pkey == nullptr) {
+    return 0;
+  }
+  int size = EVP_PKEY_size(pkey);
+  return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+/**
+ * @brief Initializes @p ctx to sign or verify with @p pkey, as SignerFilter and VerifierFilter do
+ * @param[out] sm2PkeyCtx key context attached to @p ctx that the caller must free
+ */
+static bool
+initSigningContext(EVP_MD_CTX* ctx, DigestAlgorithm algo, EVP_PKEY* pkey, KeyType keyType,
+                   const Sm2DigestCtx* sm2Ctx, bool isSigning, EVP_PKEY_CTX*& sm2PkeyCtx)
+{
+  if (keyType == KeyType::SM2) {
+    if (sm2Ctx != nullptr && algo == DigestAlgorithm::SM3) {
+      return sm2Ctx->copyTo(ctx);
+    }
+    if (EVP_PKEY_id(pkey) != EVP_PKEY_SM2 && EVP_PKEY_set_alias_type(pkey, EVP_PKEY_SM2) != 1) {
+      return false;
+    }
+    sm2PkeyCtx = setSm2PkeyCtx(ctx, pkey);
+    if (sm2PkeyCtx == nullptr) {
+      return false;
+    }
+  }
+
+  const EVP_MD* md = digestAlgorithmToEvpMd(algo);
+  if (md == nullptr) {
+    return false;
+  }
+  int ret = isSigning ? EVP_DigestSignInit(ctx, nullptr, md, nullptr, pkey) :
+                        EVP_DigestVerifyInit(ctx, nullptr, md, nullptr, pkey);
+  if (ret != 1) {
+    return false;
+  }
+
+#ifdef EVP_MD_CTX_FLAG_FINALISE
+  // the context is finalized only once, which spares OpenSSL from duplicating it
+  EVP_MD_CTX_set_flags(ctx, EVP_MD_CTX_FLAG_FINALISE);
+#endif
+  return true;
+}
+
+size_t
+EvpCrypto::sign(DigestAlgorithm algo, const transform::PrivateKey& key, KeyType keyType,
+                const InputBuffers& bufs, span<uint8_t> sig) noexcept
+{
+  auto pkey = reinterpret_cast<EVP_PKEY*>(key.getEvpPkey());
+  if (pkey == nullptr) {
+    return 0;
+  }
+  if (keyType == KeyType::NONE) {
+    keyType = key.getKeyType();
+  }
+
+  try {
+    // the key context is freed after ctx, to which it remains attached
+    EVP_PKEY_CTX* sm2PkeyCtx = nullptr;
+    auto guard = make_scope_exit([&sm2PkeyCtx] { EVP_PKEY_CTX_free(sm2PkeyCtx); });
+    EvpMdCtx ctx;
+
+    if (!initSigningContext(ctx, algo, pkey, keyType, key.getSm2DigestCtx(), true, sm2PkeyCtx)) {
+      return 0;
+    }
+    for (const auto& buf : bufs) {
+      if (EVP_DigestSignUpdate(ctx, buf.data(), buf.size()) != 1) {
+        return 0;
+      }
+    }
+
+    size_t sigSize = sig.size();
+    if (EVP_DigestSignFinal(ctx, sig.data(), &sigSize) != 1) {
+      return 0;
+    }
+    return sigSize;
+  }
+  catch (const std::exception&) {
+    return 0;
+  }
+}
+
+bool
+EvpCrypto::verify(DigestAlgorithm algo, const transform::PublicKey& key, KeyType keyType,
+                  const InputBuffers& bufs, span<const uint8_t> sig) noexcept
+{
+  auto pkey = reinterpret_cast<EVP_PKEY*>(key.getEvpPkey());
+  if (pkey == nullptr) {
+    return false;
+  }
+  if (keyType == KeyType::NONE) {
+    keyType = key.getKeyType();
+  }
+
+  try {
+    // the key context is freed after ctx, to which it remains attached
+    EVP_PKEY_CTX* sm2PkeyCtx = nullptr;
+    auto guard = make_scope_exit([&sm2PkeyCtx] { EVP_PKEY_CTX_free(sm2PkeyCtx); });
+    EvpMdCtx ctx;
+
+    if (!initSigningContext(ctx, algo, pkey, keyType, key.getSm2DigestCtx(), false, sm2PkeyCtx)) {
+      return false;
+    }
+    for (const auto& buf : bufs) {
+      if (EVP_DigestVerifyUpdate(ctx, buf.data(), buf.size()) != 1) {
+        return false;
+      }
+    }
+    return EVP_DigestVerifyFinal(ctx, sig.data(), sig.size()) == 1;
+  }
+  catch (const std::exception&) {
+    return false;
+  }
+}
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
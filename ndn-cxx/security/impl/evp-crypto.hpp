@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_IMPL_EVP_CRYPTO_HPP
+#define NDN_CXX_SECURITY_IMPL_EVP_CRYPTO_HPP
+
+#include "ndn-cxx/security/security-common.hpp"
+
+namespace ndn {
+namespace security {
+
+namespace transform {
+class PrivateKey;
+class PublicKey;
+} // namespace transform
+
+namespace detail {
+
+/**
+ * @brief Direct OpenSSL EVP calls for the hot paths of the library
+ *
+ * Unlike a transform chain, which allocates a source, filters, a sink, and an output buffer for
+ * every operation, these functions read from InputBuffers and write into a span provided by the
+ * caller. They report failures through their return value instead of throwing.
+ *
+ * The security::transform API remains the general-purpose interface.
+ */
+class EvpCrypto
+{
+public:
+  /**
+   * @brief Size of the longest supported digest
+   */
+  static constexpr size_t MAX_DIGEST_SIZE = 64;
+
+  /**
+   * @brief Computes the digest of @p bufs with @p algo into @p digest
+   * @return the size of the digest, or 0 on failure, including when @p digest is too short
+   */
+  NDN_CXX_NODISCARD static size_t
+  digest(DigestAlgorithm algo, const InputBuffers& bufs, span<uint8_t> digest) noexcept;
+
+  /**
+   * @brief Computes the digest of @p buf with @p algo into @p digest
+   * @return the size of the digest, or 0 on failure, including when @p digest is too short
+   */
+  NDN_CXX_NODISCARD static size_t
+  digest(DigestAlgorithm algo, span<const uint8_t> buf, span<uint8_t> digest) noexcept;
+
+  /**
+   * @return the maximum size of a signature generated with @p key, or 0 if @p key is not loaded
+   */
+  NDN_CXX_NODISCARD static size_t
+  getMaxSignatureSize(const transform::PrivateKey& key) noexcept;
+
+  /**
+   * @brief Signs @p bufs with @p key and digest algorithm @p algo into @p sig
+   *
+   * @p keyType takes precedence over the type of @p key, which cannot tell SM2 keys from EC keys.
+   * SM2 keys prepared with PrivateKey::setSm2Alias() reuse their precomputed context.
+   *
+   * @return the size of the signature, or 0 on failure, including when @p sig is shorter than
+   *         getMaxSignatureSize()
+   */
+  NDN_CXX_NODISCARD static size_t
+  sign(DigestAlgorithm algo, const transform::PrivateKey& key, KeyType keyType,
+       const InputBuffers& bufs, span<uint8_t> sig) noexcept;
+
+  /**
+   * @brief Verifies signature @p sig of @p bufs with @p key and digest algorithm @p algo
+   *
+   * @p keyType takes precedence over the type of @p key, which cannot tell SM2 keys from EC keys.
+   * SM2 keys prepared with PublicKey::setSm2Alias() reuse their precomputed context.
+   *
+   * @return whether the signature is valid; false on failure
+   */
+  NDN_CXX_NODISCARD static bool
+  verify(DigestAlgorithm algo, const transform::PublicKey& key, KeyType keyType,
+         const InputBuffers& bufs, span<const uint8_t> sig) noexcept;
+};
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_IMPL_EVP_CRYPTO_HPP
@@ -127,6 +127,63 @@ EvpMdCtx::~EvpMdCtx()
 #endif
 }
 
+EVP_PKEY_CTX*
+setSm2PkeyCtx(EVP_MD_CTX* ctx, EVP_PKEY* key)
+{
+  // The default user id as specified in GM/T 0009-2012
+  static const char SM2_ID[] = "1234567812345678";
+
+  EVP_PKEY_CTX* pctx = EVP_PKEY_CTX_new(key, nullptr);
+  if (pctx == nullptr)
+    return nullptr;
+
+  if (EVP_PKEY_CTX_set1_id(pctx, reinterpret_cast<const uint8_t*>(SM2_ID), sizeof(SM2_ID) - 1) <= 0) {
+    EVP_PKEY_CTX_free(pctx);
+    return nullptr;
+  }
+
+  EVP_MD_CTX_set_pkey_ctx(ctx, pctx);
+  return pctx;
+}
+
+Sm2DigestCtx::Sm2DigestCtx(EVP_PKEY* key, bool isSigning)
+{
+  EVP_PKEY_CTX* pctx = nullptr;
+  int ret = 0;
+  {
+    EvpMdCtx ctx;
+    pctx = setSm2PkeyCtx(ctx, key);
+    if (pctx != nullptr) {
+      ret = isSigning ? EVP_DigestSignInit(ctx, nullptr, EVP_sm3(), nullptr, key) :
+                        EVP_DigestVerifyInit(ctx, nullptr, EVP_sm3(), nullptr, key);
+    }
+    // OpenSSL 3 computes Z upon the first update rather than during initialization
+    if (ret == 1) {
+      ret = isSigning ? EVP_DigestSignUpdate(ctx, nullptr, 0) :
+                        EVP_DigestVerifyUpdate(ctx, nullptr, 0);
+    }
+    // unlike ctx, the copy owns its key context
+    if (ret == 1) {
+      ret = EVP_MD_CTX_copy_ex(m_ctx, ctx);
+    }
+  }
+  EVP_PKEY_CTX_free(pctx);
+
+  if (ret != 1)
+    NDN_THROW(std::runtime_error("SM2 context initialization failed"));
+
+#ifdef EVP_MD_CTX_FLAG_FINALISE
+  // each copy is finalized only once, which spares OpenSSL from duplicating the key context
+  EVP_MD_CTX_set_flags(m_ctx, EVP_MD_CTX_FLAG_FINALISE);
+#endif
+}
+
+bool
+Sm2DigestCtx::copyTo(EVP_MD_CTX* ctx) const
+{
+  return EVP_MD_CTX_copy_ex(ctx, m_ctx) == 1;
+}
+
 EvpPkeyCtx::EvpPkeyCtx(EVP_PKEY* key)
   : m_ctx(EVP_PKEY_CTX_new(key, nullptr))
 {
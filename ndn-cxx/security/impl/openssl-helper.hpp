@@ -71,6 +71,48 @@ private:
   EVP_PKEY_CTX* m_ctx;
 };
 
+/**
+ * @brief Attaches to @p ctx an SM2 key context for @p key with the default SM2 user ID
+ *
+ * Must be called before EVP_DigestSignInit() or EVP_DigestVerifyInit(). The attached context
+ * is not owned by @p ctx, and must be freed with EVP_PKEY_CTX_free() once @p ctx is no longer
+ * used.
+ *
+ * @return the attached context, or nullptr on failure
+ */
+NDN_CXX_NODISCARD EVP_PKEY_CTX*
+setSm2PkeyCtx(EVP_MD_CTX* ctx, EVP_PKEY* key);
+
+/**
+ * @brief Reusable SM3withSM2 signing or verification context
+ *
+ * An SM2 signature covers SM3(Z || message), where Z is the SM3 hash of the user ID, the curve
+ * parameters, and the public key. This context is set up once per key with Z already hashed,
+ * so that each signature only needs a copy of it to hash the message. Copies can be made
+ * concurrently.
+ */
+class Sm2DigestCtx : noncopyable
+{
+public:
+  /**
+   * @param key a key bound to SM2
+   * @param isSigning whether to sign (true) or to verify (false)
+   * @throw std::runtime_error the context cannot be set up
+   */
+  Sm2DigestCtx(EVP_PKEY* key, bool isSigning);
+
+  /**
+   * @brief Initializes @p ctx as a copy of this context
+   *
+   * The key context attached to @p ctx is owned by @p ctx.
+   */
+  NDN_CXX_NODISCARD bool
+  copyTo(EVP_MD_CTX* ctx) const;
+
+private:
+  EvpMdCtx m_ctx;
+};
+
 class Bio : noncopyable
 {
 public:
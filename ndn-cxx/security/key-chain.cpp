@@ -22,8 +22,10 @@
 #include "ndn-cxx/security/key-chain.hpp"
 
 #include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/impl/parallel-for.hpp"
 #include "ndn-cxx/util/config-file.hpp"
 #include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include "ndn-cxx/security/pib/impl/pib-memory.hpp"
 #include "ndn-cxx/security/pib/impl/pib-sqlite3.hpp"
@@ -34,6 +36,7 @@
 #include "ndn-cxx/security/tpm/impl/back-end-osx.hpp"
 #endif // NDN_CXX_HAVE_OSX_FRAMEWORKS
 
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
 #include "ndn-cxx/security/transform/bool-sink.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
@@ -41,7 +44,9 @@
 #include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
 
+#include <deque>
 #include <boost/lexical_cast.hpp>
 
 namespace ndn {
@@ -381,20 +386,8 @@ KeyChain::importSafeBag(const SafeBag& safeBag, const char* pw, size_t pwLen)
 // PublicKey.getKeyType() can't differ SM2 from ECDSA.
 #if 1
   KeyType keyType = KeyType::NONE;
-  KeyType keyTypefromSig = KeyType::NONE;
-  
-  int32_t Signature_type = cert.getSignatureType();
-  if (Signature_type == tlv::SignatureSha256WithRsa)
-    keyTypefromSig =	KeyType::RSA;
-  else if (Signature_type == tlv::SignatureSha256WithEcdsa)
-    keyTypefromSig =	KeyType::EC;
-  else if (Signature_type == tlv::SignatureHmacWithSha256)
-    keyTypefromSig =	KeyType::HMAC;
-  else if (Signature_type == tlv::SignatureSm3WithSm2)
-    keyTypefromSig =	KeyType::SM2;
-  else
-    keyTypefromSig = KeyType::NONE;
-  
+  KeyType keyTypefromSig = getSignatureKeyType(cert.getSignatureType());
+
   transform::PrivateKey pkey;
   pkey.loadPkcs8(safeBag.getEncryptedKey(), pw, pwLen);
   keyType = pkey.getKeyType();
@@ -498,6 +491,46 @@ KeyChain::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey
 
 // public: signing
 
+/**
+ * @brief Returns an upper bound of the size of a signature generated with a key of type @p keyType
+ *
+ * The bound is only exceeded by RSA keys longer than 4096 bits.
+ */
+static size_t
+getMaxSignatureSize(KeyType keyType)
+{
+  switch (keyType) {
+    case KeyType::RSA:
+      return 512;
+    case KeyType::EC:
+      return 139; // DER-encoded ECDSA signature on P-521
+    case KeyType::SM2:
+      return 72; // DER-encoded signature with two 256-bit integers
+    default:
+      return 64; // HMAC or digest with SHA-512 at most
+  }
+}
+
+/**
+ * @brief Returns the capacity and the reserve from back of an EncodingBuffer that can hold
+ *        @p data signed with a key of type @p keyType without any reallocation
+ *
+ * The unsigned portion fills the front of the buffer, the SignatureValue is appended into the
+ * reserve, and the Data TLV-TYPE and TLV-LENGTH are prepended in place.
+ */
+static std::pair<size_t, size_t>
+getDataEncodingReserve(const Data& data, KeyType keyType)
+{
+  EncodingEstimator estimator;
+  size_t unsignedSize = data.wireEncode(estimator, true);
+  size_t sigSize = getMaxSignatureSize(keyType);
+  size_t sigValueSize = tlv::sizeOfVarNumber(tlv::SignatureValue) +
+                        tlv::sizeOfVarNumber(sigSize) + sigSize;
+  size_t headerSize = tlv::sizeOfVarNumber(tlv::Data) +
+                      tlv::sizeOfVarNumber(unsignedSize + sigValueSize);
+  return {headerSize + unsignedSize + sigValueSize, sigValueSize};
+}
+
 void
 KeyChain::sign(Data& data, const SigningInfo& params)
 {
@@ -505,25 +538,12 @@ KeyChain::sign(Data& data, const SigningInfo& params)
   SignatureInfo sigInfo;
   std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
 
-//added_GM, by liupenghui
-#if 1
-  KeyType keyTypefromSig = KeyType::NONE;
-  int32_t Signature_type = sigInfo.getSignatureType();
-  if (Signature_type == tlv::SignatureSha256WithRsa)
-    keyTypefromSig =	KeyType::RSA;
-  else if (Signature_type == tlv::SignatureSha256WithEcdsa)
-    keyTypefromSig =	KeyType::EC;
-  else if (Signature_type == tlv::SignatureHmacWithSha256)
-    keyTypefromSig =	KeyType::HMAC;
-  else if (Signature_type == tlv::SignatureSm3WithSm2)
-    keyTypefromSig =	KeyType::SM2;
-  else
-    keyTypefromSig = KeyType::NONE;
-#endif
+  KeyType keyTypefromSig = getSignatureKeyType(sigInfo.getSignatureType());
 
   data.setSignatureInfo(sigInfo);
 
-  EncodingBuffer encoder;
+  auto reserve = getDataEncodingReserve(data, keyTypefromSig);
+  EncodingBuffer encoder(reserve.first, reserve.second);
   data.wireEncode(encoder, true);
 
 //added_GM, by liupenghui
@@ -537,6 +557,62 @@ KeyChain::sign(Data& data, const SigningInfo& params)
   data.wireEncode(encoder, *sigValue);
 }
 
+void
+KeyChain::signBatch(span<Data> data, const SigningInfo& params, size_t nThreads)
+{
+  if (data.empty()) {
+    return;
+  }
+
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+
+  KeyType keyType = getSignatureKeyType(sigInfo.getSignatureType());
+  DigestAlgorithm digestAlgorithm = keyType == KeyType::SM2 ? DigestAlgorithm::SM3 :
+                                                              params.getDigestAlgorithm();
+
+  // EncodingBuffer cannot be moved, and each one ends up holding the wire encoding of a packet
+  std::deque<EncodingBuffer> encoders;
+  for (auto& datum : data) {
+    datum.setSignatureInfo(sigInfo);
+    auto reserve = getDataEncodingReserve(datum, keyType);
+    encoders.emplace_back(reserve.first, reserve.second);
+    datum.wireEncode(encoders.back(), true);
+  }
+
+  std::vector<ConstBufferPtr> sigValues(data.size());
+  if (keyName == SigningInfo::getDigestSha256Identity()) {
+    ndn::detail::parallelFor(data.size(), nThreads, [&] (size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        sigValues[i] = sign({encoders[i]}, keyName, keyType, digestAlgorithm);
+      }
+    });
+  }
+  else {
+    // the key handle is looked up once, as the lookup is not thread-safe
+    const tpm::KeyHandle* key = m_tpm->findKey(keyName);
+    if (key == nullptr) {
+      NDN_THROW(InvalidSigningInfoError("TPM signing failed for key `" + keyName.toUri() + "` "
+                                        "(e.g., PIB contains info about the key, but TPM is "
+                                        "missing the corresponding private key)"));
+    }
+
+    ndn::detail::parallelFor(data.size(), nThreads, [&] (size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        sigValues[i] = key->sign(digestAlgorithm, {encoders[i]}, keyType);
+      }
+    });
+  }
+
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (sigValues[i] == nullptr) {
+      NDN_THROW(Error("Failed to sign Data " + data[i].getName().toUri()));
+    }
+    data[i].wireEncode(encoders[i], *sigValues[i]);
+  }
+}
+
 void
 KeyChain::sign(Interest& interest, const SigningInfo& params)
 {
@@ -544,21 +620,7 @@ KeyChain::sign(Interest& interest, const SigningInfo& params)
   SignatureInfo sigInfo;
   std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
   
-//added_GM, by liupenghui
-#if 1
-  KeyType keyTypefromSig = KeyType::NONE;
-  int32_t Signature_type = sigInfo.getSignatureType();
-  if (Signature_type == tlv::SignatureSha256WithRsa)
-	keyTypefromSig =  KeyType::RSA;
-  else if (Signature_type == tlv::SignatureSha256WithEcdsa)
-	keyTypefromSig =  KeyType::EC;
-  else if (Signature_type == tlv::SignatureHmacWithSha256)
-	keyTypefromSig =  KeyType::HMAC;
-  else if (Signature_type == tlv::SignatureSm3WithSm2)
-	keyTypefromSig =  KeyType::SM2;
-  else
-	keyTypefromSig = KeyType::NONE;
-#endif
+  KeyType keyTypefromSig = getSignatureKeyType(sigInfo.getSignatureType());
 
   if (params.getSignedInterestFormat() == SignedInterestFormat::V03) {
     interest.setSignatureInfo(sigInfo);
@@ -809,12 +871,12 @@ KeyChain::prepareSignatureInfo(const SigningInfo& params)
 ConstBufferPtr
 KeyChain::sign(const InputBuffers& bufs, const Name& keyName, KeyType keyType, DigestAlgorithm digestAlgorithm) const
 {
-  using namespace transform;
-
   if (keyName == SigningInfo::getDigestSha256Identity()) {
-    OBufferStream os;
-    bufferSource(bufs) >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(os);
-    return os.buf();
+    auto digest = make_shared<Buffer>(util::Sha256::DIGEST_SIZE);
+    if (detail::EvpCrypto::digest(DigestAlgorithm::SHA256, bufs, *digest) != digest->size()) {
+      NDN_THROW(Error("Failed to compute SHA-256 digest"));
+    }
+    return digest;
   }
 	
   if (keyType == KeyType::SM2)
@@ -289,6 +289,24 @@ public: // signing
   void
   sign(Interest& interest, const SigningInfo& params = SigningInfo());
 
+  /**
+   * @brief Sign several Data packets according to the same signing information.
+   *
+   * The result is the same as calling sign(Data&, const SigningInfo&) on each packet in turn,
+   * but the signing key and the SignatureInfo are resolved only once, and the signatures are
+   * generated on up to @p nThreads threads. Each thread uses its own signing contexts; the
+   * packets are encoded and updated on the calling thread, in order.
+   *
+   * @param data The Data packets to sign
+   * @param params The signing parameters
+   * @param nThreads The maximum number of threads generating signatures, including the caller
+   * @throw Error Signing failed
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity, key,
+   *                                or certificate does not exist
+   */
+  void
+  signBatch(span<Data> data, const SigningInfo& params = SigningInfo(), size_t nThreads = 1);
+
 public: // export & import
   /**
    * @brief Export a certificate and its corresponding private key.
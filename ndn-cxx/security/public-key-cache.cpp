@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/util/logger.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+NDN_LOG_INIT(ndn.security.PublicKeyCache);
+
+size_t
+PublicKeyCache::getDefaultCapacity()
+{
+  return 256;
+}
+
+PublicKeyCache::Entry::Entry(const Name& certName, const Block& keyBits, bool isSm2,
+                             shared_ptr<const transform::PublicKey> key)
+  : certName(certName)
+  , keyBits(keyBits)
+  , isSm2(isSm2)
+  , key(std::move(key))
+{
+}
+
+bool
+PublicKeyCache::Entry::matches(const Certificate& cert, bool wantSm2) const
+{
+  const Block& content = cert.getContent();
+  return isSm2 == wantSm2 &&
+         content.value_size() == keyBits.value_size() &&
+         std::equal(content.value_begin(), content.value_end(), keyBits.value_begin());
+}
+
+PublicKeyCache::PublicKeyCache(size_t capacity)
+  : m_entriesByUse(m_entries.get<0>())
+  , m_entriesByName(m_entries.get<1>())
+  , m_capacity(capacity)
+{
+}
+
+PublicKeyCache::~PublicKeyCache() = default;
+
+shared_ptr<const transform::PublicKey>
+PublicKeyCache::find(const Certificate& cert, KeyType keyType)
+{
+  bool wantSm2 = keyType == KeyType::SM2;
+
+  auto it = m_entriesByName.find(cert.getName());
+  if (it != m_entriesByName.end()) {
+    if (it->matches(cert, wantSm2)) {
+      m_entriesByUse.relocate(m_entriesByUse.begin(), m_entries.project<0>(it));
+      return it->key;
+    }
+    NDN_LOG_DEBUG("Key bits of " << cert.getName() << " changed, parsing again");
+    m_entriesByName.erase(it);
+  }
+
+  const Block& content = cert.getContent();
+  auto key = make_shared<transform::PublicKey>();
+  try {
+    key->loadPkcs8({content.value(), content.value_size()});
+    if (wantSm2) {
+      key->setSm2Alias();
+    }
+  }
+  catch (const transform::PublicKey::Error& e) {
+    NDN_LOG_DEBUG("Cannot parse public key of " << cert.getName() << ": " << e.what());
+    return nullptr;
+  }
+
+  m_entriesByUse.emplace_front(cert.getName(), content, wantSm2, key);
+  if (m_entries.size() > m_capacity) {
+    m_entriesByUse.pop_back();
+  }
+  return key;
+}
+
+void
+PublicKeyCache::erase(const Name& certName)
+{
+  m_entriesByName.erase(certName);
+}
+
+void
+PublicKeyCache::clear()
+{
+  m_entries.clear();
+}
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_PUBLIC_KEY_CACHE_HPP
+#define NDN_CXX_SECURITY_PUBLIC_KEY_CACHE_HPP
+
+#include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/security/security-common.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+namespace security {
+
+namespace transform {
+class PublicKey;
+} // namespace transform
+
+inline namespace v2 {
+
+/**
+ * @brief Bounded least-recently-used cache of parsed certificate public keys.
+ *
+ * Loading the PKCS #8 public key of a certificate into an OpenSSL key object is a significant
+ * part of the cost of a signature verification. This cache keeps the parsed keys of the most
+ * recently used certificates, indexed by certificate name. An entry is reused only if the key bits
+ * of the certificate are identical to those from which the entry was parsed, therefore a forged
+ * certificate that reuses the name of a cached one cannot take advantage of the cached key.
+ *
+ * Keys used for SM2 verification are bound to SM2 once, when they are inserted into the cache.
+ *
+ * @note The cache only saves parsing work: it does not imply that a certificate is trusted.
+ */
+class PublicKeyCache : noncopyable
+{
+public:
+  /**
+   * @brief Create a public key cache.
+   *
+   * @param capacity the maximum number of keys held by the cache (default: 256)
+   */
+  explicit
+  PublicKeyCache(size_t capacity = getDefaultCapacity());
+
+  ~PublicKeyCache();
+
+  /**
+   * @brief Get the parsed public key of @p cert, parsing and caching it if necessary.
+   *
+   * @param cert    the certificate.
+   * @param keyType the type of signature the key will verify; if KeyType::SM2, the returned
+   *                key is bound to SM2.
+   * @return The parsed key, nullptr if the certificate does not carry a valid public key.
+   */
+  shared_ptr<const transform::PublicKey>
+  find(const Certificate& cert, KeyType keyType);
+
+  /**
+   * @brief Remove the key of the certificate named @p certName, if cached.
+   */
+  void
+  erase(const Name& certName);
+
+  /**
+   * @brief Remove all keys from cache
+   */
+  void
+  clear();
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+public:
+  static size_t
+  getDefaultCapacity();
+
+private:
+  class Entry
+  {
+  public:
+    Entry(const Name& certName, const Block& keyBits, bool isSm2,
+          shared_ptr<const transform::PublicKey> key);
+
+    bool
+    matches(const Certificate& cert, bool wantSm2) const;
+
+  public:
+    Name certName;
+    Block keyBits;
+    bool isSm2;
+    shared_ptr<const transform::PublicKey> key;
+  };
+
+  typedef boost::multi_index::multi_index_container<
+    Entry,
+    boost::multi_index::indexed_by<
+      boost::multi_index::sequenced<>,
+      boost::multi_index::hashed_unique<
+        boost::multi_index::member<Entry, Name, &Entry::certName>,
+        std::hash<Name>
+      >
+    >
+  > EntryIndex;
+
+  typedef EntryIndex::nth_index<0>::type EntryIndexByUse;
+  typedef EntryIndex::nth_index<1>::type EntryIndexByName;
+  EntryIndex m_entries;
+  EntryIndexByUse& m_entriesByUse;
+  EntryIndexByName& m_entriesByName;
+  size_t m_capacity;
+};
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_PUBLIC_KEY_CACHE_HPP
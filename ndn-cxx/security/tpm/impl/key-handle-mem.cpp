@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/security/tpm/impl/key-handle-mem.hpp"
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
 #include "ndn-cxx/security/transform/bool-sink.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
 #include "ndn-cxx/security/transform/private-key.hpp"
@@ -28,6 +29,8 @@
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 
+#include <algorithm>
+
 namespace ndn {
 namespace security {
 namespace tpm {
@@ -36,6 +39,11 @@ KeyHandleMem::KeyHandleMem(shared_ptr<transform::PrivateKey> key)
   : m_key(std::move(key))
 {
   BOOST_ASSERT(m_key != nullptr);
+
+  // bind an SM2 key and compute its Z value before the handle can be used by several threads
+  if (m_key->isSm2Key()) {
+    m_key->setSm2Alias();
+  }
 }
 
 
@@ -48,10 +56,20 @@ KeyHandleMem::doSign(DigestAlgorithm digestAlgo, const InputBuffers& bufs, KeyTy
 {
   using namespace transform;
 
+  auto sig = make_shared<Buffer>(std::max(detail::EvpCrypto::getMaxSignatureSize(*m_key),
+                                           detail::EvpCrypto::MAX_DIGEST_SIZE));
+  size_t sigSize = detail::EvpCrypto::sign(digestAlgo, *m_key, keyType, bufs, *sig);
+  if (sigSize > 0) {
+    sig->resize(sigSize);
+    return sig;
+  }
+
+  // the transform chain reports the cause of the failure
   OBufferStream sigOs;
   bufferSource(bufs) >> signerFilter(digestAlgo, *m_key, keyType) >> streamSink(sigOs);
   return sigOs.buf();
 }
+
 bool
 KeyHandleMem::doVerify(DigestAlgorithm digestAlgo, const InputBuffers& bufs,
                        span<const uint8_t> sig, KeyType keyType) const
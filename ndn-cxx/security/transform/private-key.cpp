@@ -78,6 +78,7 @@ public:
 
 public:
   EVP_PKEY* key = nullptr;
+  unique_ptr<detail::Sm2DigestCtx> sm2Ctx;
 
 #if OPENSSL_VERSION_NUMBER < 0x1010100fL
   size_t keySize = 0; // in bits, used only for HMAC
@@ -427,6 +428,46 @@ PrivateKey::getEvpPkey() const
   return m_impl->key;
 }
 
+const detail::Sm2DigestCtx*
+PrivateKey::getSm2DigestCtx() const
+{
+  return m_impl->sm2Ctx.get();
+}
+
+bool
+PrivateKey::isSm2Key() const
+{
+  ENSURE_PRIVATE_KEY_LOADED(m_impl->key);
+
+  if (EVP_PKEY_id(m_impl->key) == EVP_PKEY_SM2)
+    return true;
+  if (EVP_PKEY_base_id(m_impl->key) != EVP_PKEY_EC)
+    return false;
+
+  const EC_KEY* ecKey = EVP_PKEY_get0_EC_KEY(m_impl->key);
+  return ecKey != nullptr && EC_GROUP_get_curve_name(EC_KEY_get0_group(ecKey)) == NID_sm2;
+}
+
+void
+PrivateKey::setSm2Alias()
+{
+  ENSURE_PRIVATE_KEY_LOADED(m_impl->key);
+
+  if (m_impl->sm2Ctx != nullptr)
+    return;
+
+  if (EVP_PKEY_id(m_impl->key) != EVP_PKEY_SM2 &&
+      EVP_PKEY_set_alias_type(m_impl->key, EVP_PKEY_SM2) != 1)
+    NDN_THROW(Error("Failed to bind private key to SM2"));
+
+  try {
+    m_impl->sm2Ctx = make_unique<detail::Sm2DigestCtx>(m_impl->key, true);
+  }
+  catch (const std::runtime_error&) {
+    NDN_THROW_NESTED(Error("Failed to prepare SM2 signing context"));
+  }
+}
+
 ConstBufferPtr
 PrivateKey::toPkcs1() const
 {
@@ -30,6 +30,12 @@ namespace ndn {
 class KeyParams;
 
 namespace security {
+
+namespace detail {
+class EvpCrypto;
+class Sm2DigestCtx;
+} // namespace detail
+
 namespace transform {
 
 /**
@@ -293,6 +299,27 @@ public:
   ConstBufferPtr
   derivePublicKey() const;
 
+  /**
+   * @brief Check whether the loaded key is an SM2 key
+   *
+   * An SM2 key loaded from PKCS #1 or PKCS #8 has type KeyType::EC, but lies on the SM2 curve.
+   *
+   * @throw Error the key has not been loaded
+   */
+  bool
+  isSm2Key() const;
+
+  /**
+   * @brief Bind the loaded EC private key to the SM2 signature algorithm
+   *
+   * The Z value of the key is computed once here, so that each subsequent SM3withSM2
+   * SignerFilter only needs to hash the signed content. Calling this method again has no effect.
+   *
+   * @throw Error the key has not been loaded or cannot be bound to SM2
+   */
+  void
+  setSm2Alias();
+
   /**
    * @return Plain text of @p cipherText decrypted using this private key.
    *
@@ -346,6 +373,7 @@ public:
 private:
   friend class SignerFilter;
   friend class VerifierFilter;
+  friend class detail::EvpCrypto;
 
   /**
    * @return A pointer to an OpenSSL EVP_PKEY instance.
@@ -355,6 +383,12 @@ private:
   void*
   getEvpPkey() const;
 
+  /**
+   * @return The SM3withSM2 signing context prepared by setSm2Alias(), or nullptr.
+   */
+  const detail::Sm2DigestCtx*
+  getSm2DigestCtx() const;
+
 private:
   ConstBufferPtr
   toPkcs1() const;
@@ -64,6 +64,7 @@ public:
 
 public:
   EVP_PKEY* key;
+  unique_ptr<detail::Sm2DigestCtx> sm2Ctx;
 };
 
 PublicKey::PublicKey()
@@ -104,6 +105,32 @@ PublicKey::loadPkcs8(span<const uint8_t> buf)
     NDN_THROW(Error("Failed to load public key"));
 }
 
+void
+PublicKey::setSm2Alias()
+{
+  ENSURE_PUBLIC_KEY_LOADED(m_impl->key);
+
+  if (m_impl->sm2Ctx != nullptr)
+    return;
+
+  if (EVP_PKEY_id(m_impl->key) != EVP_PKEY_SM2 &&
+      EVP_PKEY_set_alias_type(m_impl->key, EVP_PKEY_SM2) != 1)
+    NDN_THROW(Error("Failed to bind public key to SM2"));
+
+  try {
+    m_impl->sm2Ctx = make_unique<detail::Sm2DigestCtx>(m_impl->key, false);
+  }
+  catch (const std::runtime_error&) {
+    NDN_THROW_NESTED(Error("Failed to prepare SM2 verification context"));
+  }
+}
+
+const detail::Sm2DigestCtx*
+PublicKey::getSm2DigestCtx() const
+{
+  return m_impl->sm2Ctx.get();
+}
+
 void
 PublicKey::loadPkcs8(std::istream& is)
 {
@@ -27,6 +27,12 @@
 
 namespace ndn {
 namespace security {
+
+namespace detail {
+class EvpCrypto;
+class Sm2DigestCtx;
+} // namespace detail
+
 namespace transform {
 
 /**
@@ -103,6 +109,19 @@ public:
   void
   loadPkcs8Base64(std::istream& is);
 
+  /**
+   * @brief Bind the loaded EC public key to the SM2 signature algorithm
+   *
+   * OpenSSL loads SM2 public keys as generic EC keys. Once this method has been called, the key
+   * can be used by any number of SM2 VerifierFilter instances without being modified again.
+   * The Z value of the key is also computed here, so that SM3withSM2 verification only needs
+   * to hash the signed content.
+   *
+   * @throw Error the key has not been loaded or cannot be bound to SM2
+   */
+  void
+  setSm2Alias();
+
   /**
    * @brief Save the public key in PKCS#8 format into a stream @p os
    */
@@ -156,6 +175,7 @@ public:
 
 private:
   friend class VerifierFilter;
+  friend class detail::EvpCrypto;
 
   /**
    * @return A pointer to an OpenSSL EVP_PKEY instance.
@@ -165,6 +185,12 @@ private:
   void*
   getEvpPkey() const;
 
+  /**
+   * @return The SM3withSM2 verification context prepared by setSm2Alias(), or nullptr.
+   */
+  const detail::Sm2DigestCtx*
+  getSm2DigestCtx() const;
+
 private:
   ConstBufferPtr
   toPkcs8() const;
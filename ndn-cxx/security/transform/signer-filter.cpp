@@ -31,8 +31,15 @@ namespace transform {
 
 class SignerFilter::Impl
 {
+public:
+  ~Impl()
+  {
+    EVP_PKEY_CTX_free(sm2PkeyCtx);
+  }
+
 public:
   detail::EvpMdCtx ctx;
+  EVP_PKEY_CTX* sm2PkeyCtx = nullptr; ///< key context attached to, but not owned by, ctx
 };
 
 //added_GM, by liupenghui
@@ -51,27 +58,27 @@ SignerFilter::SignerFilter(DigestAlgorithm algo, const PrivateKey& key, KeyType
     NDN_THROW(Error(getIndex(), "Unsupported digest algorithm " +
                     boost::lexical_cast<std::string>(algo)));
 
-  if (m_keyType ==  KeyType::SM2) {
-    EVP_PKEY_CTX *sctx = nullptr;  	
-	/* The default user id as specified in GM/T 0009-2012 */
-    const char *sm2_id = "1234567812345678";
-	  
-    if ((EVP_PKEY_set_alias_type(reinterpret_cast<EVP_PKEY*>(key.getEvpPkey()), EVP_PKEY_SM2)) != 1) {
+  if (m_keyType == KeyType::SM2) {
+    // a key prepared by PrivateKey::setSm2Alias() comes with a context in which Z is hashed
+    const auto* sm2Ctx = key.getSm2DigestCtx();
+    if (sm2Ctx != nullptr && algo == DigestAlgorithm::SM3) {
+      if (!sm2Ctx->copyTo(m_impl->ctx))
+        NDN_THROW(Error(getIndex(), "Failed to copy SM2 signing context"));
+      return;
+    }
+
+    // the key may be shared with other threads once it is bound to SM2, so it is only modified once
+    if (EVP_PKEY_id(reinterpret_cast<EVP_PKEY*>(key.getEvpPkey())) != EVP_PKEY_SM2 &&
+        EVP_PKEY_set_alias_type(reinterpret_cast<EVP_PKEY*>(key.getEvpPkey()), EVP_PKEY_SM2) != 1) {
       NDN_THROW(Error(getIndex(), "Failed to EVP_PKEY_set_alias_type"));
     }
-	
-	if (!(sctx = EVP_PKEY_CTX_new(reinterpret_cast<EVP_PKEY*>(key.getEvpPkey()), nullptr))) {
-      NDN_THROW(Error(getIndex(), "Failed to EVP_PKEY_CTX_new"));
-	}
- 
-	if (EVP_PKEY_CTX_set1_id(sctx, (const uint8_t *)sm2_id, strlen(sm2_id)) <= 0) {
-		EVP_PKEY_CTX_free(sctx);
-		NDN_THROW(Error(getIndex(), "Failed to EVP_PKEY_CTX_set1_id"));
-	}
- 
-	EVP_MD_CTX_set_pkey_ctx(m_impl->ctx, sctx);
+
+    m_impl->sm2PkeyCtx = detail::setSm2PkeyCtx(m_impl->ctx,
+                                               reinterpret_cast<EVP_PKEY*>(key.getEvpPkey()));
+    if (m_impl->sm2PkeyCtx == nullptr)
+      NDN_THROW(Error(getIndex(), "Failed to create SM2 key context"));
   }
-  	
+
   if (EVP_DigestSignInit(m_impl->ctx, nullptr, md, nullptr,
                          reinterpret_cast<EVP_PKEY*>(key.getEvpPkey())) != 1)
     NDN_THROW(Error(getIndex(), "Failed to initialize signing context with " +
@@ -119,13 +126,6 @@ SignerFilter::finalize()
   auto buffer = make_unique<OBuffer>(sigLen);
   if (EVP_DigestSignFinal(m_impl->ctx, buffer->data(), &sigLen) != 1)
     NDN_THROW(Error(getIndex(), "Failed to finalize signature"));
-  //added_GM, by liupenghui
-#if 1
-  if ((EVP_MD_CTX_pkey_ctx(m_impl->ctx) != nullptr) && (m_keyType == KeyType::SM2)) {
-    EVP_PKEY_CTX_free(EVP_MD_CTX_pkey_ctx(m_impl->ctx));
-  }
-#endif
-
   buffer->erase(buffer->begin() + sigLen, buffer->end());
   setOutputBuffer(std::move(buffer));
 
@@ -39,9 +39,15 @@ public:
   {
   }
 
+  ~Impl()
+  {
+    EVP_PKEY_CTX_free(sm2PkeyCtx);
+  }
+
 public:
   detail::EvpMdCtx ctx;
   span<const uint8_t> sig;
+  EVP_PKEY_CTX* sm2PkeyCtx = nullptr; ///< key context attached to, but not owned by, ctx
 };
 
 //added_GM, by liupenghui
@@ -51,7 +57,7 @@ VerifierFilter::VerifierFilter(DigestAlgorithm algo, const PublicKey& key, KeyTy
   : m_impl(make_unique<Impl>(sig))
   , m_keyType(keyType)
 {
-  init(algo, key.getEvpPkey());
+  init(algo, key.getEvpPkey(), key.getSm2DigestCtx());
 }
 
 VerifierFilter::VerifierFilter(DigestAlgorithm algo, const PrivateKey& key, KeyType keyType, span<const uint8_t> sig)
@@ -86,7 +92,7 @@ VerifierFilter::VerifierFilter(DigestAlgorithm algo, const PrivateKey& key, span
 VerifierFilter::~VerifierFilter() = default;
 
 void
-VerifierFilter::init(DigestAlgorithm algo, void* pkey)
+VerifierFilter::init(DigestAlgorithm algo, void* pkey, const detail::Sm2DigestCtx* sm2Ctx)
 {
   const EVP_MD* md = detail::digestAlgorithmToEvpMd(algo);
   if (md == nullptr)
@@ -95,26 +101,23 @@ VerifierFilter::init(DigestAlgorithm algo, void* pkey)
 //added_GM, by liupenghui
 #if 1
 if (m_keyType == KeyType::SM2) {
-  EVP_PKEY_CTX *sctx = nullptr; 	
-  /* The default user id as specified in GM/T 0009-2012 */
-  const char *sm2_id = "1234567812345678";
-	  
-  if ((EVP_PKEY_set_alias_type(reinterpret_cast<EVP_PKEY*>(pkey), EVP_PKEY_SM2)) != 1) {
-	NDN_THROW(Error(getIndex(), "Failed to EVP_PKEY_set_alias_type"));
-  }
-	
-  if (!(sctx = EVP_PKEY_CTX_new(reinterpret_cast<EVP_PKEY*>(pkey), nullptr))) {
-	NDN_THROW(Error(getIndex(), "Failed to EVP_PKEY_CTX_new"));
+  // keys obtained from a PublicKeyCache come with a context in which Z is hashed
+  if (sm2Ctx != nullptr && algo == DigestAlgorithm::SM3) {
+    if (!sm2Ctx->copyTo(m_impl->ctx))
+      NDN_THROW(Error(getIndex(), "Failed to copy SM2 verification context"));
+    return;
   }
- 
-  if (EVP_PKEY_CTX_set1_id(sctx, (const uint8_t *)sm2_id, strlen(sm2_id)) <= 0) {
-	 EVP_PKEY_CTX_free(sctx);
-	 NDN_THROW(Error(getIndex(), "Failed to EVP_PKEY_CTX_set1_id"));
+
+  // keys obtained from a PublicKeyCache are already bound to SM2 and must not be modified
+  if (EVP_PKEY_id(reinterpret_cast<EVP_PKEY*>(pkey)) != EVP_PKEY_SM2 &&
+      EVP_PKEY_set_alias_type(reinterpret_cast<EVP_PKEY*>(pkey), EVP_PKEY_SM2) != 1) {
+    NDN_THROW(Error(getIndex(), "Failed to EVP_PKEY_set_alias_type"));
   }
- 
-  EVP_MD_CTX_set_pkey_ctx(m_impl->ctx, sctx);
+
+  m_impl->sm2PkeyCtx = detail::setSm2PkeyCtx(m_impl->ctx, reinterpret_cast<EVP_PKEY*>(pkey));
+  if (m_impl->sm2PkeyCtx == nullptr)
+    NDN_THROW(Error(getIndex(), "Failed to create SM2 key context"));
 }
-	
 #endif
 
   int ret;
@@ -161,13 +164,6 @@ VerifierFilter::finalize()
     ok = EVP_DigestVerifyFinal(m_impl->ctx, m_impl->sig.data(), m_impl->sig.size()) == 1;
   }
 
-//added_GM, by liupenghui
-#if 1
-  if ((EVP_MD_CTX_pkey_ctx(m_impl->ctx) != nullptr) && (m_keyType == KeyType::SM2)) {
-    EVP_PKEY_CTX_free(EVP_MD_CTX_pkey_ctx(m_impl->ctx));
-  }
-#endif
-
   auto buffer = make_unique<OBuffer>(1);
   (*buffer)[0] = ok ? 1 : 0;
   setOutputBuffer(std::move(buffer));
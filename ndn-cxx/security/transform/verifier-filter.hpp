@@ -27,6 +27,11 @@
 
 namespace ndn {
 namespace security {
+
+namespace detail {
+class Sm2DigestCtx;
+} // namespace detail
+
 namespace transform {
 
 class PrivateKey;
@@ -72,7 +77,7 @@ public:
 
 private:
   void
-  init(DigestAlgorithm algo, void* pkey);
+  init(DigestAlgorithm algo, void* pkey, const detail::Sm2DigestCtx* sm2Ctx = nullptr);
 
   /**
    * @brief Write data @p buf into verifier
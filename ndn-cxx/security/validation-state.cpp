@@ -69,7 +69,10 @@ ValidationState::verifyCertificateChain(const Certificate& trustedCert)
   for (auto it = m_certificateChain.begin(); it != m_certificateChain.end(); ++it) {
     const auto& certToValidate = *it;
 
-    if (!verifySignature(certToValidate, *validatedCert)) {
+    bool isValid = m_publicKeyCache != nullptr ?
+                   verifySignature(certToValidate, *validatedCert, *m_publicKeyCache) :
+                   verifySignature(certToValidate, *validatedCert);
+    if (!isValid) {
       this->fail({ValidationError::Code::INVALID_SIGNATURE, "Invalid signature of certificate `" +
                   certToValidate.getName().toUri() + "`"});
       m_certificateChain.erase(it, m_certificateChain.end());
@@ -107,7 +110,16 @@ DataValidationState::~DataValidationState()
 void
 DataValidationState::verifyOriginalPacket(const optional<Certificate>& trustedCert)
 {
-  if (verifySignature(m_data, trustedCert)) {
+  bool isValid = trustedCert && m_publicKeyCache != nullptr ?
+                 verifySignature(m_data, *trustedCert, *m_publicKeyCache) :
+                 verifySignature(m_data, trustedCert);
+  onOriginalPacketVerified(isValid);
+}
+
+void
+DataValidationState::onOriginalPacketVerified(bool isValid)
+{
+  if (isValid) {
     NDN_LOG_TRACE_DEPTH("OK signature for data `" << m_data.getName() << "`");
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
@@ -167,7 +179,10 @@ InterestValidationState::~InterestValidationState()
 void
 InterestValidationState::verifyOriginalPacket(const optional<Certificate>& trustedCert)
 {
-  if (verifySignature(m_interest, trustedCert)) {
+  bool isValid = trustedCert && m_publicKeyCache != nullptr ?
+                 verifySignature(m_interest, *trustedCert, *m_publicKeyCache) :
+                 verifySignature(m_interest, trustedCert);
+  if (isValid) {
     NDN_LOG_TRACE_DEPTH("OK signature for interest `" << m_interest.getName() << "`");
     this->afterSuccess(m_interest);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
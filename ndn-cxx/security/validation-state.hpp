@@ -36,6 +36,7 @@ namespace ndn {
 namespace security {
 inline namespace v2 {
 
+class PublicKeyCache;
 class Validator;
 
 /**
@@ -141,6 +142,13 @@ private: // Interface intended to be used only by Validator class
 protected:
   boost::logic::tribool m_outcome;
 
+  /**
+   * @brief cache of parsed public keys, owned by the Validator
+   *
+   * If nullptr, the public key of each certificate is parsed every time it is used.
+   */
+  PublicKeyCache* m_publicKeyCache = nullptr;
+
 private:
   std::unordered_set<Name> m_seenCertificateNames;
 
@@ -195,10 +203,21 @@ private:
   void
   bypassValidation() final;
 
+  /**
+   * @brief Finish validation once the signature of the original packet has been verified
+   *
+   * Used by Validator::validateBatch(), which verifies the signatures of several packets
+   * outside of their validation states.
+   */
+  void
+  onOriginalPacketVerified(bool isValid);
+
 private:
   Data m_data;
   DataValidationSuccessCallback m_successCb;
   DataValidationFailureCallback m_failureCb;
+
+  friend Validator;
 };
 
 /**
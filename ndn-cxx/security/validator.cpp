@@ -22,9 +22,13 @@
 #include "ndn-cxx/security/validator.hpp"
 
 #include "ndn-cxx/face.hpp"
+#include "ndn-cxx/impl/parallel-for.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
+#include <unordered_map>
+
 namespace ndn {
 namespace security {
 inline namespace v2 {
@@ -38,6 +42,7 @@ Validator::Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<Certificate
   : m_policy(std::move(policy))
   , m_certFetcher(std::move(certFetcher))
   , m_maxDepth(25)
+  , m_nVerificationThreads(1)
 {
   BOOST_ASSERT(m_policy != nullptr);
   BOOST_ASSERT(m_certFetcher != nullptr);
@@ -71,12 +76,30 @@ Validator::getMaxDepth() const
   return m_maxDepth;
 }
 
+void
+Validator::setVerificationThreads(size_t nThreads)
+{
+  m_nVerificationThreads = std::max<size_t>(nThreads, 1);
+}
+
+size_t
+Validator::getVerificationThreads() const
+{
+  return m_nVerificationThreads;
+}
+
 void
 Validator::validate(const Data& data,
                     const DataValidationSuccessCallback& successCb,
                     const DataValidationFailureCallback& failureCb)
 {
-  auto state = make_shared<DataValidationState>(data, successCb, failureCb);
+  validate(data, make_shared<DataValidationState>(data, successCb, failureCb));
+}
+
+void
+Validator::validate(const Data& data, const shared_ptr<DataValidationState>& state)
+{
+  state->m_publicKeyCache = &m_publicKeyCache;
   NDN_LOG_DEBUG_DEPTH("Start validating data " << data.getName());
 
   m_policy->checkPolicy(data, state,
@@ -91,12 +114,140 @@ Validator::validate(const Data& data,
     });
 }
 
+void
+Validator::validateBatch(span<const Data> data,
+                         const DataValidationSuccessCallback& successCb,
+                         const DataValidationFailureCallback& failureCb)
+{
+  // group packets by KeyLocator name, in order of first appearance
+  std::vector<shared_ptr<std::vector<Data>>> groups;
+  std::unordered_map<Name, size_t> groupIndexes;
+  for (const auto& datum : data) {
+    const auto& sigInfo = datum.getSignatureInfo();
+    if (!sigInfo.hasKeyLocator() || sigInfo.getKeyLocator().getType() != tlv::Name) {
+      validate(datum, successCb, failureCb);
+      continue;
+    }
+
+    auto it = groupIndexes.emplace(sigInfo.getKeyLocator().getName(), groups.size()).first;
+    if (it->second == groups.size()) {
+      groups.push_back(make_shared<std::vector<Data>>());
+    }
+    groups[it->second]->push_back(datum);
+  }
+
+  NDN_LOG_DEBUG("Start validating batch of " << data.size() << " data in " << groups.size()
+                << " groups");
+
+  for (const auto& group : groups) {
+    if (group->size() == 1) {
+      validate(group->front(), successCb, failureCb);
+      continue;
+    }
+
+    // Validating the first packet retrieves and verifies the certificate chain. Its callbacks
+    // run before the chain is cached, so the rest of the group takes the signer certificate
+    // from the chain of the first packet. If it fails, the rest of the group goes through the
+    // regular validation process.
+    auto weakFirstState = make_shared<weak_ptr<DataValidationState>>();
+    auto state = make_shared<DataValidationState>(group->front(),
+      [=] (const Data& first) {
+        successCb(first);
+        auto firstState = weakFirstState->lock();
+        const Certificate* signer = nullptr;
+        if (firstState != nullptr && !firstState->m_certificateChain.empty()) {
+          signer = &firstState->m_certificateChain.back();
+        }
+        validateBatchGroup(*group, signer, successCb, failureCb);
+      },
+      [=] (const Data& first, const ValidationError& error) {
+        failureCb(first, error);
+        validateBatchGroup(*group, nullptr, successCb, failureCb);
+      });
+    *weakFirstState = state;
+    validate(group->front(), state);
+  }
+}
+
+void
+Validator::validateBatchGroup(const std::vector<Data>& group, const Certificate* signer,
+                              const DataValidationSuccessCallback& successCb,
+                              const DataValidationFailureCallback& failureCb)
+{
+  struct Verification
+  {
+    shared_ptr<DataValidationState> state;
+    shared_ptr<const transform::PublicKey> key;
+    bool isValid;
+  };
+
+  struct Context
+  {
+    std::vector<Verification> verifications;
+    bool isCollecting = true;
+  };
+
+  auto ctx = make_shared<Context>();
+  ctx->verifications.reserve(group.size() - 1);
+
+  for (auto datum = std::next(group.begin()); datum != group.end(); ++datum) {
+    auto state = make_shared<DataValidationState>(*datum, successCb, failureCb);
+    state->m_publicKeyCache = &m_publicKeyCache;
+    NDN_LOG_DEBUG_DEPTH("Start validating data " << datum->getName());
+
+    m_policy->checkPolicy(*datum, state,
+      [this, ctx, signer] (const shared_ptr<CertificateRequest>& certRequest,
+                           const shared_ptr<ValidationState>& state) {
+        if (certRequest == nullptr) {
+          state->bypassValidation();
+          return;
+        }
+
+        const Certificate* cert = nullptr;
+        if (ctx->isCollecting && state->getDepth() < m_maxDepth &&
+            certRequest->interest.getName() != SigningInfo::getDigestSha256Identity()) {
+          cert = findTrustedCert(certRequest->interest);
+          if (cert == nullptr && signer != nullptr && certRequest->interest.matchesData(*signer)) {
+            cert = signer;
+          }
+        }
+        if (cert == nullptr) {
+          requestCertificate(certRequest, state);
+          return;
+        }
+
+        NDN_LOG_TRACE_DEPTH("Found trusted certificate " << cert->getName());
+        auto dataState = static_pointer_cast<DataValidationState>(state);
+        const Data& data = dataState->getOriginalData();
+        // ensure that the signed portion is encoded before it is accessed by several threads
+        data.wireEncode();
+        auto key = m_publicKeyCache.find(*cert, getSignatureKeyType(data.getSignatureType()));
+        ctx->verifications.push_back({std::move(dataState), std::move(key), false});
+      });
+  }
+  ctx->isCollecting = false;
+
+  auto& verifications = ctx->verifications;
+  ndn::detail::parallelFor(verifications.size(), m_nVerificationThreads,
+    [&verifications] (size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        auto& v = verifications[i];
+        v.isValid = v.key != nullptr && verifySignature(v.state->getOriginalData(), *v.key);
+      }
+    });
+
+  for (const auto& v : verifications) {
+    v.state->onOriginalPacketVerified(v.isValid);
+  }
+}
+
 void
 Validator::validate(const Interest& interest,
                     const InterestValidationSuccessCallback& successCb,
                     const InterestValidationFailureCallback& failureCb)
 {
   auto state = make_shared<InterestValidationState>(interest, successCb, failureCb);
+  state->m_publicKeyCache = &m_publicKeyCache;
 
   auto fmt = interest.getSignatureInfo() ? SignedInterestFormat::V03 : SignedInterestFormat::V02;
   state->setTag(make_shared<SignedInterestFormatTag>(fmt));
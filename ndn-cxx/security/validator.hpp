@@ -89,6 +89,20 @@ public:
   size_t
   getMaxDepth() const;
 
+  /**
+   * @brief Set the maximum number of threads used by validateBatch() to verify signatures
+   *
+   * The default value 1 verifies all signatures on the thread that runs the validator.
+   */
+  void
+  setVerificationThreads(size_t nThreads);
+
+  /**
+   * @return The maximum number of threads used by validateBatch() to verify signatures
+   */
+  size_t
+  getVerificationThreads() const;
+
   /**
    * @brief Asynchronously validate @p data
    *
@@ -99,6 +113,25 @@ public:
            const DataValidationSuccessCallback& successCb,
            const DataValidationFailureCallback& failureCb);
 
+  /**
+   * @brief Asynchronously validate a batch of Data packets
+   *
+   * Packets are grouped by the name in their KeyLocator. The certificate chain of each group is
+   * retrieved and verified once, while validating the first packet of the group; the signatures
+   * of the other packets of the group are then verified with the key of the same trusted
+   * certificate, on up to getVerificationThreads() threads. Packets without a KeyLocator name
+   * are validated as if passed to validate() one at a time.
+   *
+   * For each packet, either @p successCb or @p failureCb is invoked, always on the thread that
+   * runs the validator. The packets are copied, so @p data does not need to outlive the call.
+   *
+   * @note @p successCb and @p failureCb must not be nullptr
+   */
+  void
+  validateBatch(span<const Data> data,
+                const DataValidationSuccessCallback& successCb,
+                const DataValidationFailureCallback& failureCb);
+
   /**
    * @brief Asynchronously validate @p interest
    *
@@ -157,6 +190,12 @@ public: // anchor management
   resetVerifiedCertificates();
 
 private: // Common validator operations
+  /**
+   * @brief Start the validation of @p data, whose callbacks are held by @p state
+   */
+  void
+  validate(const Data& data, const shared_ptr<DataValidationState>& state);
+
   /**
    * @brief Recursive validation of the certificate in the certification chain
    *
@@ -176,10 +215,23 @@ private: // Common validator operations
   requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
                      const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Validate Data packets that share the KeyLocator of an already validated packet
+   *
+   * Packets whose signer is found among trusted certificates, or is @p signer (the verified
+   * signer of the first packet, if any), have their signatures verified together, possibly
+   * in parallel; the others go through the regular validation process.
+   */
+  void
+  validateBatchGroup(const std::vector<Data>& group, const Certificate* signer,
+                     const DataValidationSuccessCallback& successCb,
+                     const DataValidationFailureCallback& failureCb);
+
 private:
   unique_ptr<ValidationPolicy> m_policy;
   unique_ptr<CertificateFetcher> m_certFetcher;
   size_t m_maxDepth;
+  size_t m_nVerificationThreads;
 };
 
 } // inline namespace v2
@@ -25,8 +25,10 @@
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
 #include "ndn-cxx/security/impl/openssl.hpp"
 #include "ndn-cxx/security/pib/key.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
 #include "ndn-cxx/security/tpm/tpm.hpp"
 #include "ndn-cxx/security/transform/bool-sink.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
@@ -34,6 +36,8 @@
 #include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
+
+#include <array>
 //added_GM, by liupenghui 
 #if 1
 #include <iostream>
@@ -64,28 +68,31 @@ public:
 
 } // namespace
 
+KeyType
+getSignatureKeyType(int32_t sigType)
+{
+  switch (sigType) {
+  case tlv::SignatureSha256WithRsa:
+    return KeyType::RSA;
+  case tlv::SignatureSha256WithEcdsa:
+    return KeyType::EC;
+  case tlv::SignatureHmacWithSha256:
+    return KeyType::HMAC;
+  case tlv::SignatureSm3WithSm2:
+    return KeyType::SM2;
+  default:
+    return KeyType::NONE;
+  }
+}
+
 //added_GM, by liupenghui 
 #if 1
 bool
 verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, const transform::PublicKey& key, KeyType keyType)
 {
-  bool result = false;
-  try {
-    using namespace transform;
-	
-	if (keyType == KeyType::SM2) {
-      bufferSource(blobs) >> verifierFilter(DigestAlgorithm::SM3, key, keyType, sig)
-                        >> boolSink(result);
-	} else {
-	  bufferSource(blobs) >> verifierFilter(DigestAlgorithm::SHA256, key, keyType, sig)
-							>> boolSink(result);
-	}
-  }
-  catch (const transform::Error&) {
-    return false;
-  }
-
-  return result;
+  return detail::EvpCrypto::verify(keyType == KeyType::SM2 ? DigestAlgorithm::SM3 :
+                                                             DigestAlgorithm::SHA256,
+                                   key, keyType, blobs, sig);
 }
 
 bool
@@ -231,22 +238,14 @@ verifyDigest(const ParseResult& params, DigestAlgorithm algorithm)
     return false;
   }
 
-  OBufferStream os;
-  try {
-    using namespace transform;
-    bufferSource(params.bufs) >> digestFilter(algorithm) >> streamSink(os);
-  }
-  catch (const transform::Error&) {
-    return false;
-  }
-  auto result = os.buf();
-
-  if (result->size() != params.sig.size()) {
+  std::array<uint8_t, detail::EvpCrypto::MAX_DIGEST_SIZE> result;
+  size_t resultSize = detail::EvpCrypto::digest(algorithm, params.bufs, result);
+  if (resultSize == 0 || resultSize != params.sig.size()) {
     return false;
   }
 
   // constant-time buffer comparison to mitigate timing attacks
-  return CRYPTO_memcmp(result->data(), params.sig.data(), params.sig.size()) == 0;
+  return CRYPTO_memcmp(result.data(), params.sig.data(), params.sig.size()) == 0;
 }
 
 bool
@@ -652,6 +651,30 @@ verifySignature(const Interest& interest, const optional<Certificate>& cert)
   }
 }
 
+static bool
+verifySignature(const ParseResult& params, const Certificate& cert, PublicKeyCache& keyCache)
+{
+  if (params.bufs.empty()) {
+    return false;
+  }
+
+  KeyType keyType = getSignatureKeyType(params.info.getSignatureType());
+  auto key = keyCache.find(cert, keyType);
+  return key != nullptr && verifySignature(params.bufs, params.sig, *key, keyType);
+}
+
+bool
+verifySignature(const Data& data, const Certificate& cert, PublicKeyCache& keyCache)
+{
+  return verifySignature(parse(data), cert, keyCache);
+}
+
+bool
+verifySignature(const Interest& interest, const Certificate& cert, PublicKeyCache& keyCache)
+{
+  return verifySignature(parse(interest), cert, keyCache);
+}
+
 //added_GM, by liupenghui 
 #if 1
 bool
@@ -46,8 +46,16 @@ class PublicKey;
 
 inline namespace v2 {
 class Certificate;
+class PublicKeyCache;
 } // inline namespace v2
 
+/**
+ * @brief Return the type of key that verifies signatures of type @p sigType.
+ * @return KeyType::NONE if @p sigType is not a public key or HMAC signature type
+ */
+NDN_CXX_NODISCARD KeyType
+getSignatureKeyType(int32_t sigType);
+
 /**
  * @brief Verify @p blobs using @p key against @p sig.
  */
@@ -155,6 +163,19 @@ verifySignature(const Data& data, const optional<Certificate>& cert);
 NDN_CXX_NODISCARD bool
 verifySignature(const Interest& interest, const optional<Certificate>& cert);
 
+/**
+ * @brief Verify @p data using @p cert, whose parsed public key is obtained from @p keyCache.
+ */
+NDN_CXX_NODISCARD bool
+verifySignature(const Data& data, const Certificate& cert, PublicKeyCache& keyCache);
+
+/**
+ * @brief Verify @p interest using @p cert, whose parsed public key is obtained from @p keyCache.
+ * @note This method verifies only signature of the signed interest.
+ */
+NDN_CXX_NODISCARD bool
+verifySignature(const Interest& interest, const Certificate& cert, PublicKeyCache& keyCache);
+
 /**
  * @brief Verify @p data using @p tpm and @p keyName with the @p digestAlgorithm.
  */
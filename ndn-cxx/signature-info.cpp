@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/signature-info.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/encoding-arena.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 
@@ -103,13 +104,10 @@ SignatureInfo::wireEncode(SignatureInfo::Type type) const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator, type);
+  EncodingArena arena;
+  wireEncode(arena.encoder(), type);
 
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer, type);
-
-  m_wire = buffer.block();
+  m_wire = arena.block();
   return m_wire;
 }
 
@@ -27,8 +27,8 @@
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/write.hpp>
 
-#include <list>
-#include <queue>
+#include <atomic>
+#include <deque>
 
 namespace ndn {
 namespace detail {
@@ -43,7 +43,7 @@ class StreamTransportImpl : public std::enable_shared_from_this<StreamTransportI
 {
 public:
   using Impl = StreamTransportImpl<BaseTransport, Protocol>;
-  using TransmissionQueue = std::queue<Block, std::list<Block>>;
+  using TransmissionQueue = std::deque<Block>;
 
   StreamTransportImpl(BaseTransport& transport, boost::asio::io_service& ioService)
     : m_transport(transport)
@@ -86,6 +86,7 @@ public:
     m_transport.m_isConnected = false;
     m_transport.m_isReceiving = false;
     TransmissionQueue{}.swap(m_transmissionQueue); // clear the queue
+    m_nBlocksInFlight = 0;
   }
 
   void
@@ -109,6 +110,9 @@ public:
     if (!m_transport.m_isReceiving) {
       m_transport.m_isReceiving = true;
       m_inputBufferSize = 0;
+      // discard any partial element, without overwriting what received Blocks may refer to
+      m_chunkBegin = m_chunkEnd;
+      m_receiveMode = m_transport.m_receiveMode;
       asyncReceive();
     }
   }
@@ -116,12 +120,12 @@ public:
   void
   send(const Block& block)
   {
-    m_transmissionQueue.push(block);
+    m_transmissionQueue.push_back(block);
 
-    if (m_transport.m_isConnected && m_transmissionQueue.size() == 1) {
+    if (m_transport.m_isConnected && m_nBlocksInFlight == 0) {
       asyncWrite();
     }
-    // if not connected or there's another transmission in progress (m_transmissionQueue.size() > 1),
+    // if not connected or there's another transmission in progress (m_nBlocksInFlight > 0),
     // the next write will be scheduled either in connectHandler or in asyncWriteHandler
   }
 
@@ -160,9 +164,24 @@ protected:
   asyncWrite()
   {
     BOOST_ASSERT(!m_transmissionQueue.empty());
-    boost::asio::async_write(m_socket, boost::asio::buffer(m_transmissionQueue.front()),
+    BOOST_ASSERT(m_nBlocksInFlight == 0);
+
+    // coalesce as many queued blocks as the batch size permits into a single vectored write;
+    // the first block is always included, even if it alone exceeds the batch size
+    m_writeBuffers.clear();
+    size_t nBytes = 0;
+    for (const Block& block : m_transmissionQueue) {
+      if (!m_writeBuffers.empty() && nBytes + block.size() > m_transport.m_maxWriteBatchSize) {
+        break;
+      }
+      m_writeBuffers.push_back(block);
+      nBytes += block.size();
+    }
+    m_nBlocksInFlight = m_writeBuffers.size();
+
+    boost::asio::async_write(m_socket, m_writeBuffers,
       // capture a copy of the shared_ptr to "this" to prevent deallocation
-      [this, self = this->shared_from_this()] (const auto& error, size_t) {
+      [this, self = this->shared_from_this()] (const auto& error, size_t nBytesWritten) {
         if (error) {
           if (error == boost::system::errc::operation_canceled) {
             // async receive has been explicitly cancelled (e.g., socket close)
@@ -176,8 +195,16 @@ protected:
           return; // queue has been already cleared
         }
 
-        BOOST_ASSERT(!m_transmissionQueue.empty());
-        m_transmissionQueue.pop();
+        BOOST_ASSERT(m_transmissionQueue.size() >= m_nBlocksInFlight);
+        auto& counters = m_transport.m_writeCounters;
+        ++counters.nBatches;
+        counters.nPackets += m_nBlocksInFlight;
+        counters.nBytes += nBytesWritten;
+        counters.maxBatchPackets = std::max(counters.maxBatchPackets, m_nBlocksInFlight);
+
+        m_transmissionQueue.erase(m_transmissionQueue.begin(),
+                                  m_transmissionQueue.begin() + m_nBlocksInFlight);
+        m_nBlocksInFlight = 0;
 
         if (!m_transmissionQueue.empty()) {
           asyncWrite();
@@ -188,6 +215,11 @@ protected:
   void
   asyncReceive()
   {
+    if (m_receiveMode == Transport::ReceiveMode::SHARED_CHUNK) {
+      asyncReceiveIntoChunk();
+      return;
+    }
+
     m_socket.async_receive(boost::asio::buffer(m_inputBuffer + m_inputBufferSize,
                                                MAX_NDN_PACKET_SIZE - m_inputBufferSize), 0,
       // capture a copy of the shared_ptr to "this" to prevent deallocation
@@ -241,17 +273,130 @@ protected:
     return true;
   }
 
+  void
+  asyncReceiveIntoChunk()
+  {
+    // the unprocessed remainder plus the rest of a TLV element must fit in the current chunk
+    if (m_chunk == nullptr || m_chunk->size() - m_chunkBegin < MAX_NDN_PACKET_SIZE) {
+      renewChunk();
+    }
+
+    m_socket.async_receive(boost::asio::buffer(m_chunk->data() + m_chunkEnd,
+                                               m_chunk->size() - m_chunkEnd), 0,
+      // capture a copy of the shared_ptr to "this" to prevent deallocation
+      [this, self = this->shared_from_this()] (const auto& error, size_t nBytesRecvd) {
+        if (error) {
+          if (error == boost::system::errc::operation_canceled) {
+            // async receive has been explicitly cancelled (e.g., socket close)
+            return;
+          }
+          m_transport.close();
+          NDN_THROW(Transport::Error(error, "error while receiving data from socket"));
+        }
+
+        m_chunkEnd += nBytesRecvd;
+        processAllReceivedInChunk();
+        if (m_chunkEnd - m_chunkBegin >= MAX_NDN_PACKET_SIZE) {
+          m_transport.close();
+          NDN_THROW(Transport::Error("input buffer full, but a valid TLV cannot be decoded"));
+        }
+
+        asyncReceive();
+      });
+  }
+
+  void
+  processAllReceivedInChunk()
+  {
+    ConstBufferPtr chunk = m_chunk;
+    auto end = chunk->begin() + m_chunkEnd;
+    while (m_chunkBegin < m_chunkEnd) {
+      auto begin = chunk->begin() + m_chunkBegin;
+      auto pos = begin;
+      uint32_t type = 0;
+      uint64_t length = 0;
+      if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length) ||
+          length > static_cast<uint64_t>(end - pos)) {
+        return;
+      }
+
+      auto valueEnd = pos + length;
+      m_chunkBegin += static_cast<size_t>(valueEnd - begin);
+      m_transport.m_receiveCallback(Block(chunk, type, begin, valueEnd, pos, valueEnd));
+    }
+  }
+
+  /**
+   * \brief Switch to a receive chunk with enough room for a complete TLV element,
+   *        carrying over the unprocessed remainder of the current chunk.
+   *
+   * The current chunk is reused in place if no received Block refers to it anymore.
+   * Otherwise, a retired chunk that is no longer referenced is taken from the pool,
+   * or a new chunk is allocated.
+   */
+  void
+  renewChunk()
+  {
+    size_t remainder = m_chunkEnd - m_chunkBegin;
+    if (m_chunk != nullptr && m_chunk.use_count() == 1) {
+      // the last Block referring to the chunk may have been released by another thread
+      std::atomic_thread_fence(std::memory_order_acquire);
+      std::copy(m_chunk->begin() + m_chunkBegin, m_chunk->begin() + m_chunkEnd, m_chunk->begin());
+      m_chunkBegin = 0;
+      m_chunkEnd = remainder;
+      return;
+    }
+
+    shared_ptr<Buffer> next;
+    auto unused = std::find_if(m_chunkPool.begin(), m_chunkPool.end(),
+                               [] (const auto& chunk) { return chunk.use_count() == 1; });
+    if (unused != m_chunkPool.end()) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      next = std::move(*unused);
+      m_chunkPool.erase(unused);
+    }
+    else {
+      next = make_shared<Buffer>(RECEIVE_CHUNK_SIZE);
+    }
+
+    if (m_chunk != nullptr) {
+      std::copy(m_chunk->begin() + m_chunkBegin, m_chunk->begin() + m_chunkEnd, next->begin());
+      if (m_chunkPool.size() < MAX_POOLED_CHUNKS) {
+        m_chunkPool.push_back(std::move(m_chunk));
+      }
+    }
+    m_chunk = std::move(next);
+    m_chunkBegin = 0;
+    m_chunkEnd = remainder;
+  }
+
 protected:
+  static constexpr size_t RECEIVE_CHUNK_SIZE = 8 * MAX_NDN_PACKET_SIZE;
+  static constexpr size_t MAX_POOLED_CHUNKS = 8;
+
   BaseTransport& m_transport;
 
   typename Protocol::socket m_socket;
   uint8_t m_inputBuffer[MAX_NDN_PACKET_SIZE];
   size_t m_inputBufferSize = 0;
+  Transport::ReceiveMode m_receiveMode = Transport::ReceiveMode::COPY;
+  shared_ptr<Buffer> m_chunk; ///< receive chunk in SHARED_CHUNK mode
+  size_t m_chunkBegin = 0; ///< offset of the first unprocessed octet in m_chunk
+  size_t m_chunkEnd = 0; ///< offset past the last received octet in m_chunk
+  std::vector<shared_ptr<Buffer>> m_chunkPool; ///< retired chunks, possibly still referenced
   TransmissionQueue m_transmissionQueue;
+  std::vector<boost::asio::const_buffer> m_writeBuffers;
+  size_t m_nBlocksInFlight = 0; ///< number of blocks at the front of the queue being written
   boost::asio::steady_timer m_connectTimer;
   bool m_isConnecting = false;
 };
 
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::RECEIVE_CHUNK_SIZE;
+
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::MAX_POOLED_CHUNKS;
+
 } // namespace detail
 } // namespace ndn
 
@@ -46,6 +46,24 @@ public:
   using ReceiveCallback = std::function<void(const Block& wire)>;
   using ErrorCallback = std::function<void()>;
 
+  /**
+   * \brief How a stream-oriented transport hands received TLV elements to the receive callback.
+   */
+  enum class ReceiveMode {
+    /**
+     * \brief Each TLV element is copied out of a fixed input buffer into its own Buffer.
+     */
+    COPY,
+    /**
+     * \brief TLV elements are delivered as Blocks that share ownership of a larger
+     *        reference-counted receive chunk, without per-packet allocation or copying.
+     *
+     * A chunk remains allocated as long as any Block received into it (or any sub-element
+     * of such a Block) is alive; retired chunks are reused once they are no longer referenced.
+     */
+    SHARED_CHUNK,
+  };
+
   virtual
   ~Transport() = default;
 
@@ -88,6 +106,61 @@ public:
   virtual void
   resume() = 0;
 
+  /**
+   * \brief Statistics of the write path of the transport.
+   */
+  struct WriteCounters
+  {
+    uint64_t nBatches = 0; ///< number of write operations issued to the socket
+    uint64_t nPackets = 0; ///< number of TLV blocks written
+    uint64_t nBytes = 0;   ///< number of octets written
+    size_t maxBatchPackets = 0; ///< largest number of TLV blocks coalesced into one write
+  };
+
+  /**
+   * \brief Set the maximum number of octets coalesced into a single write operation.
+   *
+   * TLV blocks queued while a write is in progress are written together in the next
+   * write operation, in the order they were sent, up to this limit. A block larger than
+   * the limit is written on its own. Setting the limit to zero disables coalescing.
+   */
+  void
+  setMaxWriteBatchSize(size_t nOctets) noexcept
+  {
+    m_maxWriteBatchSize = nOctets;
+  }
+
+  size_t
+  getMaxWriteBatchSize() const noexcept
+  {
+    return m_maxWriteBatchSize;
+  }
+
+  /**
+   * \brief Return the statistics of the write path.
+   */
+  const WriteCounters&
+  getWriteCounters() const noexcept
+  {
+    return m_writeCounters;
+  }
+
+  /**
+   * \brief Select how received TLV elements are delivered.
+   * \note The new mode takes effect on the next resume().
+   */
+  void
+  setReceiveMode(ReceiveMode mode) noexcept
+  {
+    m_receiveMode = mode;
+  }
+
+  ReceiveMode
+  getReceiveMode() const noexcept
+  {
+    return m_receiveMode;
+  }
+
   /**
    * \brief Return whether the transport is connected.
    */
@@ -112,6 +185,9 @@ protected:
   ReceiveCallback m_receiveCallback;
   bool m_isConnected = false;
   bool m_isReceiving = false;
+  size_t m_maxWriteBatchSize = 65536;
+  ReceiveMode m_receiveMode = ReceiveMode::COPY;
+  WriteCounters m_writeCounters;
 };
 
 } // namespace ndn
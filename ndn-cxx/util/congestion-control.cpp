@@ -0,0 +1,276 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/congestion-control.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ndn {
+namespace util {
+
+constexpr double CongestionControl::MIN_SSTHRESH;
+
+static double
+toSeconds(time::nanoseconds d)
+{
+  return time::duration_cast<time::duration<double, time::seconds::period>>(d).count();
+}
+
+CongestionControl::CongestionControl(double initCwnd, double initSsthresh)
+  : m_cwnd(initCwnd)
+  , m_ssthresh(initSsthresh)
+{
+}
+
+CongestionControl::~CongestionControl() = default;
+
+AimdCongestionControl::AimdCongestionControl(const Options& options)
+  : CongestionControl(options.initCwnd, options.initSsthresh)
+  , m_options(options)
+{
+}
+
+void
+AimdCongestionControl::onAck(time::steady_clock::TimePoint, optional<time::nanoseconds>)
+{
+  if (m_cwnd < m_ssthresh) {
+    m_cwnd += m_options.aiStep; // additive increase
+  }
+  else {
+    m_cwnd += m_options.aiStep / std::floor(m_cwnd); // congestion avoidance
+  }
+}
+
+void
+AimdCongestionControl::onCongestion(time::steady_clock::TimePoint)
+{
+  // Refer to RFC 5681, Section 3.1 for the rationale behind the code below
+  m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * m_options.mdCoef); // multiplicative decrease
+  m_cwnd = m_options.resetCwndToInit ? m_options.initCwnd : m_ssthresh;
+}
+
+CubicCongestionControl::CubicCongestionControl(const Options& options)
+  : CongestionControl(options.initCwnd, options.initSsthresh)
+  , m_options(options)
+{
+}
+
+void
+CubicCongestionControl::onAck(time::steady_clock::TimePoint now, optional<time::nanoseconds> rtt)
+{
+  if (rtt) {
+    m_minRtt = std::min(m_minRtt, *rtt);
+  }
+
+  if (m_cwnd < m_ssthresh) {
+    m_cwnd += 1.0; // slow start
+    return;
+  }
+
+  if (!m_isInEpoch) {
+    m_isInEpoch = true;
+    m_epochStart = now;
+    if (m_cwnd < m_wMax) {
+      m_k = std::cbrt((m_wMax - m_cwnd) / m_options.c);
+      m_origin = m_wMax;
+    }
+    else {
+      m_k = 0.0;
+      m_origin = m_cwnd;
+    }
+    m_wEst = m_cwnd;
+  }
+
+  // Refer to RFC 8312, Section 4 for the rationale behind the code below
+  auto elapsed = now - m_epochStart;
+  if (m_minRtt != time::nanoseconds::max()) {
+    elapsed += m_minRtt;
+  }
+  double t = toSeconds(elapsed) - m_k;
+  double target = std::min(m_options.c * t * t * t + m_origin, 1.5 * m_cwnd);
+  if (target > m_cwnd) {
+    m_cwnd += (target - m_cwnd) / m_cwnd; // concave or convex region
+  }
+  else {
+    m_cwnd += 0.01 / m_cwnd; // plateau
+  }
+
+  if (m_options.enableTcpFriendliness) {
+    m_wEst += 3.0 * (1.0 - m_options.beta) / (1.0 + m_options.beta) / m_cwnd;
+    m_cwnd = std::max(m_cwnd, m_wEst);
+  }
+}
+
+void
+CubicCongestionControl::onCongestion(time::steady_clock::TimePoint)
+{
+  m_isInEpoch = false;
+
+  if (m_options.enableFastConvergence && m_cwnd < m_wMax) {
+    m_wMax = m_cwnd * (1.0 + m_options.beta) / 2.0;
+  }
+  else {
+    m_wMax = m_cwnd;
+  }
+
+  m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * m_options.beta);
+  m_cwnd = m_ssthresh;
+}
+
+// Gains applied to the BDP in consecutive rounds of PROBE_BW: probe for more bandwidth,
+// drain the queue this may have built up, then cruise
+static const double BBR_GAIN_CYCLE[] = {1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+
+// Lowest gain that allows the window to double every round during startup, i.e., 2/ln(2)
+static const double BBR_STARTUP_GAIN = 2.89;
+
+// Startup ends after this many rounds without the bandwidth estimate growing by 25%
+static const int BBR_FULL_BW_ROUNDS = 3;
+static const double BBR_FULL_BW_GROWTH = 1.25;
+
+BbrCongestionControl::BbrCongestionControl(const Options& options)
+  : CongestionControl(options.initCwnd, std::numeric_limits<double>::max())
+  , m_options(options)
+{
+}
+
+double
+BbrCongestionControl::getBandwidth() const
+{
+  double bw = 0.0;
+  for (const auto& sample : m_bwSamples) {
+    bw = std::max(bw, sample.second);
+  }
+  return bw;
+}
+
+double
+BbrCongestionControl::getBdp() const
+{
+  if (!m_minRtt) {
+    return 0.0;
+  }
+  return getBandwidth() * toSeconds(*m_minRtt);
+}
+
+void
+BbrCongestionControl::onAck(time::steady_clock::TimePoint now, optional<time::nanoseconds> rtt)
+{
+  if (rtt && (!m_minRtt || *rtt <= *m_minRtt || now - m_minRttStamp > m_options.minRttWindow)) {
+    m_minRtt = *rtt;
+    m_minRttStamp = now;
+  }
+
+  if (!m_minRtt) {
+    // rounds cannot be delimited without an RTT sample
+    m_cwnd += 1.0;
+    return;
+  }
+
+  if (!m_isInRound) {
+    startRound(now);
+  }
+  ++m_nDeliveredInRound;
+  if (now - m_roundStart >= *m_minRtt && now > m_roundStart) {
+    endRound(now);
+  }
+
+  switch (m_mode) {
+    case Mode::STARTUP:
+      m_cwnd += 1.0; // doubles the window every round
+      if (m_nRounds > 0) {
+        m_cwnd = std::min(m_cwnd, std::max(m_options.minCwnd, getBdp() * BBR_STARTUP_GAIN));
+      }
+      break;
+    case Mode::DRAIN:
+      m_cwnd = std::max(m_options.minCwnd, getBdp());
+      break;
+    case Mode::PROBE_BW:
+      m_cwnd = std::max(m_options.minCwnd, getBdp() * BBR_GAIN_CYCLE[m_cycleIndex]);
+      break;
+  }
+}
+
+void
+BbrCongestionControl::onCongestion(time::steady_clock::TimePoint)
+{
+  double bdp = getBdp();
+  if (bdp == 0.0) {
+    m_cwnd = std::max(MIN_SSTHRESH, m_cwnd / 2.0);
+    return;
+  }
+
+  if (m_mode == Mode::STARTUP) {
+    // a loss means that the window has already overflowed the bottleneck queue: leave startup
+    // instead of waiting for the bandwidth to stop growing, and drain the queue
+    m_mode = Mode::DRAIN;
+  }
+  else if (m_mode == Mode::PROBE_BW && BBR_GAIN_CYCLE[m_cycleIndex] > 1.0) {
+    ++m_cycleIndex; // stop probing
+  }
+  m_cwnd = std::max(m_options.minCwnd, std::min(m_cwnd, bdp));
+}
+
+void
+BbrCongestionControl::startRound(time::steady_clock::TimePoint now)
+{
+  m_isInRound = true;
+  m_roundStart = now;
+  m_nDeliveredInRound = 0;
+}
+
+void
+BbrCongestionControl::endRound(time::steady_clock::TimePoint now)
+{
+  ++m_nRounds;
+  m_bwSamples.emplace_back(m_nRounds, m_nDeliveredInRound / toSeconds(now - m_roundStart));
+  while (!m_bwSamples.empty() &&
+         m_bwSamples.front().first + m_options.bandwidthWindow <= m_nRounds) {
+    m_bwSamples.pop_front();
+  }
+
+  switch (m_mode) {
+    case Mode::STARTUP: {
+      double bw = getBandwidth();
+      if (bw >= m_fullBw * BBR_FULL_BW_GROWTH) {
+        m_fullBw = bw;
+        m_nFullBwRounds = 0;
+      }
+      else if (++m_nFullBwRounds >= BBR_FULL_BW_ROUNDS) {
+        m_mode = Mode::DRAIN;
+      }
+      break;
+    }
+    case Mode::DRAIN:
+      m_mode = Mode::PROBE_BW;
+      m_cycleIndex = 0;
+      break;
+    case Mode::PROBE_BW:
+      m_cycleIndex = (m_cycleIndex + 1) % (sizeof(BBR_GAIN_CYCLE) / sizeof(BBR_GAIN_CYCLE[0]));
+      break;
+  }
+
+  startRound(now);
+}
+
+} // namespace util
+} // namespace ndn
@@ -0,0 +1,266 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_CONGESTION_CONTROL_HPP
+#define NDN_CXX_UTIL_CONGESTION_CONTROL_HPP
+
+#include "ndn-cxx/util/optional.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <deque>
+#include <limits>
+
+namespace ndn {
+namespace util {
+
+/**
+ * @brief Congestion control algorithm that manages the Interest window of a consumer.
+ *
+ * The window is expressed in segments. The consumer reports each received segment with
+ * onAck(), and each congestion event (a loss or a congestion mark) with onCongestion().
+ */
+class CongestionControl : noncopyable
+{
+public:
+  virtual
+  ~CongestionControl();
+
+  /**
+   * @brief Returns the congestion window, in segments.
+   */
+  double
+  getCwnd() const
+  {
+    return m_cwnd;
+  }
+
+  /**
+   * @brief Returns the slow start threshold, in segments.
+   */
+  double
+  getSsthresh() const
+  {
+    return m_ssthresh;
+  }
+
+  /**
+   * @brief Informs the algorithm that a segment was received without a congestion mark.
+   * @param now time of receipt
+   * @param rtt RTT sample of the segment; not present if the segment was retransmitted
+   */
+  virtual void
+  onAck(time::steady_clock::TimePoint now, optional<time::nanoseconds> rtt) = 0;
+
+  /**
+   * @brief Informs the algorithm of a congestion event.
+   *
+   * When Conservative Window Adaptation is enabled, the consumer reports at most one congestion
+   * event per window of data.
+   */
+  virtual void
+  onCongestion(time::steady_clock::TimePoint now) = 0;
+
+public:
+  static constexpr double MIN_SSTHRESH = 2.0;
+
+protected:
+  CongestionControl(double initCwnd, double initSsthresh);
+
+protected:
+  double m_cwnd;
+  double m_ssthresh;
+};
+
+/**
+ * @brief Additive Increase Multiplicative Decrease.
+ *
+ * The window grows by `aiStep` for each segment during slow start, and by `aiStep` per window
+ * of data during congestion avoidance. It is multiplied by `mdCoef` upon a congestion event.
+ */
+class AimdCongestionControl : public CongestionControl
+{
+public:
+  class Options
+  {
+  public:
+    Options()
+    {
+    }
+
+  public:
+    double initCwnd = 1.0; ///< initial congestion window size
+    double initSsthresh = std::numeric_limits<double>::max(); ///< initial slow start threshold
+    double aiStep = 1.0; ///< additive increase step (in segments)
+    double mdCoef = 0.5; ///< multiplicative decrease coefficient
+    bool resetCwndToInit = false; ///< reduce cwnd to initCwnd when a congestion event occurs
+  };
+
+  explicit
+  AimdCongestionControl(const Options& options = Options());
+
+  void
+  onAck(time::steady_clock::TimePoint now, optional<time::nanoseconds> rtt) final;
+
+  void
+  onCongestion(time::steady_clock::TimePoint now) final;
+
+private:
+  Options m_options;
+};
+
+/**
+ * @brief CUBIC congestion control, as specified in RFC 8312.
+ *
+ * After a congestion event, the window follows a cubic function of the time elapsed since the
+ * event, so that it quickly regains the size at which the event occurred and then probes
+ * beyond it. Unlike AIMD, the growth does not depend on the RTT, which suits paths with a large
+ * bandwidth-delay product.
+ */
+class CubicCongestionControl : public CongestionControl
+{
+public:
+  class Options
+  {
+  public:
+    Options()
+    {
+    }
+
+  public:
+    double initCwnd = 1.0; ///< initial congestion window size
+    double initSsthresh = std::numeric_limits<double>::max(); ///< initial slow start threshold
+    double c = 0.4; ///< scaling constant of the cubic function (in segments per second cubed)
+    double beta = 0.7; ///< multiplicative decrease factor
+    bool enableFastConvergence = true; ///< release bandwidth faster when the window shrinks
+    bool enableTcpFriendliness = true; ///< grow at least as fast as AIMD would
+  };
+
+  explicit
+  CubicCongestionControl(const Options& options = Options());
+
+  void
+  onAck(time::steady_clock::TimePoint now, optional<time::nanoseconds> rtt) final;
+
+  void
+  onCongestion(time::steady_clock::TimePoint now) final;
+
+private:
+  Options m_options;
+  double m_wMax = 0.0;   ///< window size just before the last reduction
+  double m_origin = 0.0; ///< plateau of the cubic function
+  double m_k = 0.0;      ///< time to reach the plateau, in seconds
+  double m_wEst = 0.0;   ///< window that AIMD would have reached
+  bool m_isInEpoch = false;
+  time::steady_clock::TimePoint m_epochStart;
+  time::nanoseconds m_minRtt = time::nanoseconds::max();
+};
+
+/**
+ * @brief Delay-based congestion control modeled after BBR.
+ *
+ * Instead of reacting to losses, this algorithm estimates the bottleneck bandwidth (the maximum
+ * delivery rate over the last few rounds) and the propagation delay (the minimum RTT), and sets
+ * the window to their product, the bandwidth-delay product (BDP). It doubles the window every
+ * round until the bandwidth estimate stops growing or a loss occurs, drains the queue built up
+ * meanwhile, and then periodically probes for more bandwidth by cycling the window gain.
+ *
+ * Since Interests are not paced, the gain is applied to the window rather than to the sending
+ * rate. Congestion events only end startup or bandwidth probing and cap the window at the BDP,
+ * so that random losses do not reduce the throughput.
+ */
+class BbrCongestionControl : public CongestionControl
+{
+public:
+  class Options
+  {
+  public:
+    Options()
+    {
+    }
+
+  public:
+    double initCwnd = 1.0; ///< initial congestion window size
+    double minCwnd = 4.0; ///< lower bound of the window once the BDP is known
+    size_t bandwidthWindow = 10; ///< number of rounds over which the maximum bandwidth is kept
+    time::nanoseconds minRttWindow = 10_s; ///< time after which the minimum RTT expires
+  };
+
+  enum class Mode {
+    STARTUP,
+    DRAIN,
+    PROBE_BW,
+  };
+
+  explicit
+  BbrCongestionControl(const Options& options = Options());
+
+  void
+  onAck(time::steady_clock::TimePoint now, optional<time::nanoseconds> rtt) final;
+
+  void
+  onCongestion(time::steady_clock::TimePoint now) final;
+
+  Mode
+  getMode() const
+  {
+    return m_mode;
+  }
+
+  /**
+   * @brief Returns the estimated bottleneck bandwidth, in segments per second.
+   */
+  double
+  getBandwidth() const;
+
+  /**
+   * @brief Returns the estimated bandwidth-delay product, in segments.
+   */
+  double
+  getBdp() const;
+
+private:
+  void
+  startRound(time::steady_clock::TimePoint now);
+
+  void
+  endRound(time::steady_clock::TimePoint now);
+
+private:
+  Options m_options;
+  Mode m_mode = Mode::STARTUP;
+  optional<time::nanoseconds> m_minRtt;
+  time::steady_clock::TimePoint m_minRttStamp;
+
+  bool m_isInRound = false;
+  time::steady_clock::TimePoint m_roundStart;
+  uint64_t m_nDeliveredInRound = 0;
+  uint64_t m_nRounds = 0;
+  std::deque<std::pair<uint64_t, double>> m_bwSamples; ///< (round, delivery rate)
+
+  double m_fullBw = 0.0;      ///< bandwidth at the last significant growth during startup
+  int m_nFullBwRounds = 0;    ///< rounds without significant growth during startup
+  size_t m_cycleIndex = 0;    ///< position in the gain cycle during PROBE_BW
+};
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_CONGESTION_CONTROL_HPP
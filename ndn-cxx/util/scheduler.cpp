@@ -48,8 +48,427 @@ public:
   Scheduler::EventQueue::const_iterator queueIt;
   time::steady_clock::TimePoint expireTime;
   bool isExpired = false;
+
+  // the following fields are used by the TIMER_WHEEL backend
+  shared_ptr<EventInfo> self; ///< keeps the event alive while it is in the wheel
+  EventInfo* prev = nullptr;
+  EventInfo* next = nullptr;
+  uint64_t tick = 0; ///< expiration time, in ticks, rounded up
+  size_t slot = 0;   ///< list that contains the event
+};
+
+namespace {
+
+/** \brief Pool of fixed-size memory blocks for the EventInfo records of a timing wheel
+ *
+ *  Blocks are allocated in chunks of growing size, and are retained until the pool is released.
+ *  Since an EventId can keep its record allocated after the Scheduler is destructed, the pool is
+ *  released only after it has been orphaned by its timing wheel and all its blocks have been
+ *  returned.
+ */
+class EventPool : noncopyable
+{
+public:
+  void*
+  allocate(size_t size)
+  {
+    if (m_blockSize == 0) {
+      // every block must be suitably aligned and able to hold a free list link
+      const size_t alignment = alignof(std::max_align_t);
+      m_blockSize = (std::max(size, sizeof(void*)) + alignment - 1) / alignment * alignment;
+    }
+    BOOST_ASSERT(size <= m_blockSize);
+
+    if (m_freeList == nullptr) {
+      grow();
+    }
+    void* block = m_freeList;
+    m_freeList = *static_cast<void**>(block);
+    ++m_nAllocated;
+    return block;
+  }
+
+  void
+  deallocate(void* block) noexcept
+  {
+    *static_cast<void**>(block) = m_freeList;
+    m_freeList = block;
+    if (--m_nAllocated == 0 && m_isOrphaned) {
+      delete this;
+    }
+  }
+
+  /** \brief Releases the pool as soon as all its blocks have been returned
+   */
+  void
+  orphan() noexcept
+  {
+    m_isOrphaned = true;
+    if (m_nAllocated == 0) {
+      delete this;
+    }
+  }
+
+private:
+  ~EventPool() = default;
+
+  void
+  grow()
+  {
+    size_t nBlocks = std::min<size_t>(256 << std::min<size_t>(m_chunks.size(), 8), 65536);
+    m_chunks.emplace_back(new unsigned char[nBlocks * m_blockSize]);
+
+    unsigned char* chunk = m_chunks.back().get();
+    for (size_t i = 0; i < nBlocks; ++i) {
+      void* block = chunk + i * m_blockSize;
+      *static_cast<void**>(block) = m_freeList;
+      m_freeList = block;
+    }
+  }
+
+private:
+  std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+  void* m_freeList = nullptr;
+  size_t m_blockSize = 0;
+  size_t m_nAllocated = 0;
+  bool m_isOrphaned = false;
+};
+
+/** \brief Allocator for std::allocate_shared that takes memory from an EventPool
+ */
+template<typename T>
+class PoolAllocator
+{
+public:
+  using value_type = T;
+
+  explicit
+  PoolAllocator(EventPool* pool) noexcept
+    : m_pool(pool)
+  {
+  }
+
+  template<typename U>
+  PoolAllocator(const PoolAllocator<U>& other) noexcept
+    : m_pool(other.m_pool)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    BOOST_ASSERT(n == 1);
+    return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t) noexcept
+  {
+    m_pool->deallocate(p);
+  }
+
+  template<typename U>
+  bool
+  operator==(const PoolAllocator<U>& other) const noexcept
+  {
+    return m_pool == other.m_pool;
+  }
+
+  template<typename U>
+  bool
+  operator!=(const PoolAllocator<U>& other) const noexcept
+  {
+    return m_pool != other.m_pool;
+  }
+
+private:
+  EventPool* m_pool;
+
+  template<typename U>
+  friend class PoolAllocator;
+};
+
+/** \brief Returns the index of the least significant set bit of a non-zero \p x
+ */
+size_t
+findFirstSet(uint64_t x)
+{
+  static const uint8_t table[64] = {
+     0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+    62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+    63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+    46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6,
+  };
+
+  BOOST_ASSERT(x != 0);
+  // isolate the lowest set bit, and look up its position with a de Bruijn sequence
+  return table[((x & (~x + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+} // namespace
+
+/** \brief Hierarchical timing wheel of the TIMER_WHEEL backend
+ *
+ *  Time is divided into ticks of TIMER_WHEEL_TICK. The wheel has N_LEVELS levels of N_SLOTS
+ *  slots each; a slot at level L covers N_SLOTS^L ticks. An event is stored in the lowest level
+ *  whose slots can tell its expiration tick apart from the current tick. When the current tick
+ *  reaches the start of a slot at a higher level, the events in that slot are cascaded into
+ *  lower levels; the events in a slot at level 0 are due. Events too far in the future for the
+ *  highest level are stored at the end of its range and re-placed when they get there.
+ *
+ *  Each slot is an intrusive doubly linked list, and a bitmap per level records non-empty slots,
+ *  so that inserting, removing, and finding the next slot to process take constant time.
+ */
+class Scheduler::TimerWheel : noncopyable
+{
+public:
+  static constexpr size_t SLOT_BITS = 6;
+  static constexpr size_t N_SLOTS = size_t(1) << SLOT_BITS;
+  static constexpr size_t N_LEVELS = 6;
+  static constexpr uint64_t SPAN_MASK = (uint64_t(1) << (SLOT_BITS * N_LEVELS)) - 1;
+
+  /// list of events that are due to be executed
+  static constexpr size_t DUE = N_LEVELS * N_SLOTS;
+  /// marks an event that is not in the wheel
+  static constexpr size_t NONE = DUE + 1;
+
+  static constexpr uint64_t NOT_ARMED = std::numeric_limits<uint64_t>::max();
+
+  TimerWheel()
+    : m_pool(new EventPool)
+  {
+  }
+
+  ~TimerWheel()
+  {
+    clear();
+    m_pool->orphan();
+  }
+
+  /** \brief Converts a time point to ticks, rounding down
+   */
+  static uint64_t
+  toTick(time::steady_clock::TimePoint t)
+  {
+    return static_cast<uint64_t>(std::max(t.time_since_epoch(), time::nanoseconds::zero()) /
+                                 TIMER_WHEEL_TICK);
+  }
+
+  shared_ptr<EventInfo>
+  makeEvent(time::nanoseconds after, EventCallback&& callback)
+  {
+    auto info = std::allocate_shared<EventInfo>(PoolAllocator<EventInfo>(m_pool),
+                                                after, std::move(callback));
+    info->tick = toTick(info->expireTime + TIMER_WHEEL_TICK - 1_ns);
+    info->self = info;
+    ++m_nEvents;
+    return info;
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return m_nEvents == 0;
+  }
+
+  /** \brief Inserts \p info into its slot
+   *  \return the tick when the slot must be processed
+   */
+  uint64_t
+  place(EventInfo* info)
+  {
+    // events in the past are due at the current tick; events beyond the range of the wheel are
+    // stored at the end of the range
+    uint64_t pos = std::min(std::max(info->tick, m_current), m_current | SPAN_MASK);
+
+    size_t level = 0;
+    while ((pos >> ((level + 1) * SLOT_BITS)) != (m_current >> ((level + 1) * SLOT_BITS))) {
+      ++level;
+    }
+    BOOST_ASSERT(level < N_LEVELS);
+
+    size_t index = (pos >> (level * SLOT_BITS)) & (N_SLOTS - 1);
+    append(level * N_SLOTS + index, info);
+    m_occupied[level] |= uint64_t(1) << index;
+
+    uint64_t start = pos >> (level * SLOT_BITS) << (level * SLOT_BITS);
+    return std::max(start, m_current);
+  }
+
+  /** \brief Removes a pending event
+   *  \return whether the event was in the wheel
+   */
+  bool
+  remove(EventInfo& info) noexcept
+  {
+    if (info.slot == NONE) {
+      return false;
+    }
+
+    unlink(&info);
+    --m_nEvents;
+    info.self.reset();
+    return true;
+  }
+
+  /** \brief Takes the next event that is due at or before \p nowTick
+   *  \return the event, or nullptr if no event is due
+   */
+  shared_ptr<EventInfo>
+  popDue(uint64_t nowTick)
+  {
+    if (m_slots[DUE].head == nullptr) {
+      advance(nowTick);
+    }
+
+    EventInfo* info = m_slots[DUE].head;
+    if (info == nullptr) {
+      return nullptr;
+    }
+    unlink(info);
+    --m_nEvents;
+    return std::move(info->self);
+  }
+
+  /** \brief Returns the tick when the wheel must be processed next, or NOT_ARMED if it is empty
+   */
+  uint64_t
+  getNextTick() const noexcept
+  {
+    if (m_slots[DUE].head != nullptr) {
+      // events left over by a callback that threw are executed immediately
+      return 0;
+    }
+    size_t level = 0;
+    uint64_t tick = 0;
+    return findNext(level, tick) ? tick : NOT_ARMED;
+  }
+
+  void
+  clear()
+  {
+    // the records are released after the wheel has been emptied, because destroying a callback
+    // may cancel other events
+    std::vector<shared_ptr<EventInfo>> events;
+    events.reserve(m_nEvents);
+    for (auto& slot : m_slots) {
+      for (EventInfo* info = slot.head; info != nullptr; info = info->next) {
+        info->slot = NONE;
+        events.push_back(std::move(info->self));
+      }
+      slot = {};
+    }
+    std::fill(std::begin(m_occupied), std::end(m_occupied), 0);
+    m_nEvents = 0;
+    events.clear();
+  }
+
+private:
+  struct Slot
+  {
+    EventInfo* head = nullptr;
+    EventInfo* tail = nullptr;
+  };
+
+  void
+  append(size_t slotIndex, EventInfo* info) noexcept
+  {
+    Slot& slot = m_slots[slotIndex];
+    info->slot = slotIndex;
+    info->prev = slot.tail;
+    info->next = nullptr;
+    if (slot.tail != nullptr) {
+      slot.tail->next = info;
+    }
+    else {
+      slot.head = info;
+    }
+    slot.tail = info;
+  }
+
+  void
+  unlink(EventInfo* info) noexcept
+  {
+    Slot& slot = m_slots[info->slot];
+    (info->prev != nullptr ? info->prev->next : slot.head) = info->next;
+    (info->next != nullptr ? info->next->prev : slot.tail) = info->prev;
+    if (slot.head == nullptr && info->slot != DUE) {
+      m_occupied[info->slot / N_SLOTS] &= ~(uint64_t(1) << (info->slot % N_SLOTS));
+    }
+    info->slot = NONE;
+    info->prev = info->next = nullptr;
+  }
+
+  /** \brief Finds the earliest slot to process
+   *
+   *  A slot at level 0 is processed at its tick, and a slot at a higher level at its start.
+   *  On ties, the highest level is preferred, so that its events are cascaded first.
+   */
+  bool
+  findNext(size_t& level, uint64_t& tick) const noexcept
+  {
+    bool isFound = false;
+    for (size_t l = N_LEVELS; l-- > 0;) {
+      size_t shift = l * SLOT_BITS;
+      uint64_t pending = m_occupied[l] & (~uint64_t(0) << ((m_current >> shift) & (N_SLOTS - 1)));
+      if (pending == 0) {
+        BOOST_ASSERT(m_occupied[l] == 0);
+        continue;
+      }
+
+      uint64_t start = (m_current >> (shift + SLOT_BITS) << (shift + SLOT_BITS)) |
+                       (uint64_t(findFirstSet(pending)) << shift);
+      start = std::max(start, m_current);
+      if (!isFound || start < tick) {
+        level = l;
+        tick = start;
+        isFound = true;
+      }
+    }
+    return isFound;
+  }
+
+  /** \brief Processes all slots up to \p nowTick, moving due events into the DUE list
+   */
+  void
+  advance(uint64_t nowTick)
+  {
+    size_t level = 0;
+    uint64_t tick = 0;
+    while (findNext(level, tick) && tick <= nowTick) {
+      size_t slotIndex = level * N_SLOTS + ((tick >> (level * SLOT_BITS)) & (N_SLOTS - 1));
+      EventInfo* info = std::exchange(m_slots[slotIndex].head, nullptr);
+      m_slots[slotIndex].tail = nullptr;
+      m_occupied[level] &= ~(uint64_t(1) << (slotIndex % N_SLOTS));
+
+      m_current = level == 0 ? tick + 1 : tick;
+      while (info != nullptr) {
+        EventInfo* next = info->next;
+        if (level == 0 && info->tick < m_current) {
+          append(DUE, info);
+        }
+        else {
+          place(info);
+        }
+        info = next;
+      }
+    }
+    m_current = std::max(m_current, nowTick + 1);
+  }
+
+public:
+  uint64_t armedTick = NOT_ARMED; ///< tick when the timer of the Scheduler expires
+
+private:
+  EventPool* m_pool;
+  Slot m_slots[N_LEVELS * N_SLOTS + 1];
+  uint64_t m_occupied[N_LEVELS] = {};
+  uint64_t m_current = 0; ///< the earliest tick that has not been processed
+  size_t m_nEvents = 0;
 };
 
+const time::nanoseconds Scheduler::TIMER_WHEEL_TICK = 1_ms;
+
 EventId::EventId(Scheduler& sched, weak_ptr<EventInfo> info)
   : CancelHandle([&sched, info] { sched.cancelImpl(info.lock()); })
   , m_info(std::move(info))
@@ -81,9 +500,12 @@ Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
   return a->expireTime < b->expireTime;
 }
 
-Scheduler::Scheduler(boost::asio::io_service& ioService)
+Scheduler::Scheduler(boost::asio::io_service& ioService, Backend backend)
   : m_timer(make_unique<util::detail::SteadyTimer>(ioService))
 {
+  if (backend == Backend::TIMER_WHEEL) {
+    m_wheel = make_unique<TimerWheel>();
+  }
 }
 
 Scheduler::~Scheduler() = default;
@@ -93,6 +515,16 @@ Scheduler::schedule(time::nanoseconds after, EventCallback callback)
 {
   BOOST_ASSERT(callback != nullptr);
 
+  if (m_wheel != nullptr) {
+    auto info = m_wheel->makeEvent(after, std::move(callback));
+    uint64_t tick = m_wheel->place(info.get());
+    if (!m_isEventExecuting && tick < m_wheel->armedTick) {
+      // the new event is the first one to expire
+      scheduleNext();
+    }
+    return EventId(*this, info);
+  }
+
   auto i = m_queue.insert(std::make_shared<EventInfo>(after, std::move(callback)));
   (*i)->queueIt = i;
 
@@ -111,6 +543,14 @@ Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
     return;
   }
 
+  if (m_wheel != nullptr) {
+    if (m_wheel->remove(*info) && m_wheel->empty()) {
+      m_timer->cancel();
+      m_wheel->armedTick = TimerWheel::NOT_ARMED;
+    }
+    return;
+  }
+
   if (info->queueIt == m_queue.begin()) {
     m_timer->cancel();
   }
@@ -125,12 +565,26 @@ void
 Scheduler::cancelAllEvents()
 {
   m_queue.clear();
+  if (m_wheel != nullptr) {
+    m_wheel->clear();
+    m_wheel->armedTick = TimerWheel::NOT_ARMED;
+  }
   m_timer->cancel();
 }
 
 void
 Scheduler::scheduleNext()
 {
+  if (m_wheel != nullptr) {
+    m_wheel->armedTick = m_wheel->getNextTick();
+    if (m_wheel->armedTick != TimerWheel::NOT_ARMED) {
+      auto expireTime = time::steady_clock::TimePoint(m_wheel->armedTick * TIMER_WHEEL_TICK);
+      m_timer->expires_from_now(std::max(expireTime - time::steady_clock::now(), 0_ns));
+      m_timer->async_wait([this] (const auto& error) { this->executeEvent(error); });
+    }
+    return;
+  }
+
   if (!m_queue.empty()) {
     m_timer->expires_from_now((*m_queue.begin())->expiresFromNow());
     m_timer->async_wait([this] (const auto& error) { this->executeEvent(error); });
@@ -144,23 +598,46 @@ Scheduler::executeEvent(const boost::system::error_code& error)
     return;
   }
 
-  auto guard = make_scope_exit([this] {
+  size_t nExecuted = 0;
+  auto guard = make_scope_exit([this, &nExecuted] {
     m_isEventExecuting = false;
+    ++m_counters.nWakeups;
+    m_counters.nExecutedEvents += nExecuted;
+    m_counters.maxEventsPerWakeup = std::max(m_counters.maxEventsPerWakeup, nExecuted);
     scheduleNext();
   });
   m_isEventExecuting = true;
 
-  // process all expired events
-  auto now = time::steady_clock::now();
-  while (!m_queue.empty()) {
+  auto hasQuota = [this, &nExecuted] {
+    return m_maxEventsPerWakeup == 0 || nExecuted < m_maxEventsPerWakeup;
+  };
+
+  // process all expired events, including those that expire within the batch slack
+  auto deadline = time::steady_clock::now() + m_batchSlack;
+  if (m_wheel != nullptr) {
+    uint64_t deadlineTick = TimerWheel::toTick(deadline);
+    while (hasQuota()) {
+      auto info = m_wheel->popDue(deadlineTick);
+      if (info == nullptr) {
+        break;
+      }
+      info->isExpired = true;
+      ++nExecuted;
+      info->callback();
+    }
+    return;
+  }
+
+  while (!m_queue.empty() && hasQuota()) {
     auto head = m_queue.begin();
     shared_ptr<EventInfo> info = *head;
-    if (info->expireTime > now) {
+    if (info->expireTime > deadline) {
       break;
     }
 
     m_queue.erase(head);
     info->isExpired = true;
+    ++nExecuted;
     info->callback();
   }
 }
@@ -134,8 +134,30 @@ using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 class Scheduler : noncopyable
 {
 public:
+  /** \brief Data structure that holds the scheduled events
+   */
+  enum class Backend {
+    /** \brief A balanced tree ordered by expiration time
+     *
+     *  Scheduling and canceling an event take O(log n) time.
+     *  Events are executed in the order of their expiration times.
+     */
+    TREE,
+    /** \brief A hierarchical timing wheel with pooled event records
+     *
+     *  Scheduling and canceling an event take O(1) time.
+     *  Expiration times are rounded up to a multiple of TIMER_WHEEL_TICK, and the order of
+     *  execution among events that expire within the same tick is unspecified.
+     */
+    TIMER_WHEEL,
+  };
+
+  /** \brief Resolution of the TIMER_WHEEL backend
+   */
+  static const time::nanoseconds TIMER_WHEEL_TICK;
+
   explicit
-  Scheduler(boost::asio::io_service& ioService);
+  Scheduler(boost::asio::io_service& ioService, Backend backend = Backend::TREE);
 
   ~Scheduler();
 
@@ -150,6 +172,56 @@ public:
   void
   cancelAllEvents();
 
+  /** \brief Set how early events may be executed to batch them with earlier events
+   *
+   *  When the scheduler wakes up to execute expired events, it also executes the events that
+   *  expire within \p slack from now, saving the wakeups they would need. The default is zero.
+   */
+  void
+  setBatchSlack(time::nanoseconds slack)
+  {
+    m_batchSlack = std::max(slack, time::nanoseconds::zero());
+  }
+
+  time::nanoseconds
+  getBatchSlack() const
+  {
+    return m_batchSlack;
+  }
+
+  /** \brief Limit the number of events executed in one wakeup
+   *
+   *  Remaining expired events are executed in the next wakeup, which is scheduled immediately,
+   *  so that other handlers of the io_service are not delayed by a long batch.
+   *  Zero, the default, means no limit.
+   */
+  void
+  setMaxEventsPerWakeup(size_t n)
+  {
+    m_maxEventsPerWakeup = n;
+  }
+
+  size_t
+  getMaxEventsPerWakeup() const
+  {
+    return m_maxEventsPerWakeup;
+  }
+
+  /** \brief Statistics of event execution
+   */
+  struct Counters
+  {
+    uint64_t nWakeups = 0;        ///< number of times the scheduler woke up to execute events
+    uint64_t nExecutedEvents = 0; ///< number of executed events
+    size_t maxEventsPerWakeup = 0; ///< largest number of events executed in one wakeup
+  };
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
 private:
   void
   cancelImpl(const shared_ptr<EventInfo>& info);
@@ -159,7 +231,7 @@ private:
   void
   scheduleNext();
 
-  /** \brief Execute expired events
+  /** \brief Execute expired events, and events that expire within the batch slack
    *
    *  If an event callback throws, the exception is propagated to the thread running the io_service.
    *  In case there are other expired events, they will be processed in the next invocation.
@@ -178,9 +250,16 @@ private:
   using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
   EventQueue m_queue;
 
+  class TimerWheel;
+  unique_ptr<TimerWheel> m_wheel; ///< used instead of m_queue by the TIMER_WHEEL backend
+
   unique_ptr<util::detail::SteadyTimer> m_timer;
   bool m_isEventExecuting = false;
 
+  time::nanoseconds m_batchSlack = time::nanoseconds::zero();
+  size_t m_maxEventsPerWakeup = 0;
+  Counters m_counters;
+
   friend EventId;
   friend EventInfo;
 };
@@ -23,7 +23,6 @@
 
 #include "ndn-cxx/util/segment-fetcher.hpp"
 #include "ndn-cxx/name-component.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/lp/nack-header.hpp"
 
@@ -31,7 +30,10 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/range/adaptor/map.hpp>
 
-#include <cmath>
+#include <cerrno>
+#include <cstring>
+
+#include <unistd.h>
 
 namespace ndn {
 namespace util {
@@ -56,6 +58,14 @@ SegmentFetcher::Options::validate()
   if (mdCoef < 0.0 || mdCoef > 1.0) {
     NDN_THROW(std::invalid_argument("mdCoef must be in range [0, 1]"));
   }
+
+  if (outputFd >= 0 && inOrder) {
+    NDN_THROW(std::invalid_argument("'file' mode cannot be combined with 'in order' mode"));
+  }
+
+  if (resumeSegment > 0 && outputFd < 0) {
+    NDN_THROW(std::invalid_argument("resumeSegment requires 'file' mode"));
+  }
 }
 
 SegmentFetcher::SegmentFetcher(Face& face,
@@ -67,10 +77,24 @@ SegmentFetcher::SegmentFetcher(Face& face,
   , m_validator(validator)
   , m_rttEstimator(make_shared<RttEstimator::Options>(options.rttOptions))
   , m_timeLastSegmentReceived(time::steady_clock::now())
-  , m_cwnd(options.initCwnd)
-  , m_ssthresh(options.initSsthresh)
+  , m_nextSegmentNum(options.resumeSegment)
+  , m_nextSegmentInOrder(options.resumeSegment)
 {
   m_options.validate();
+
+  if (m_options.makeCongestionControl) {
+    m_cc = m_options.makeCongestionControl(m_options);
+  }
+  else {
+    AimdCongestionControl::Options ccOptions;
+    ccOptions.initCwnd = m_options.initCwnd;
+    ccOptions.initSsthresh = m_options.initSsthresh;
+    ccOptions.aiStep = m_options.aiStep;
+    ccOptions.mdCoef = m_options.mdCoef;
+    ccOptions.resetCwndToInit = m_options.resetCwndToInit;
+    m_cc = make_unique<AimdCongestionControl>(ccOptions);
+  }
+  BOOST_ASSERT(m_cc != nullptr);
 }
 
 shared_ptr<SegmentFetcher>
@@ -127,10 +151,11 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
 
   int64_t availableWindowSize;
   if (m_options.inOrder) {
-    availableWindowSize = std::min<int64_t>(m_cwnd, m_options.flowControlWindow - m_segmentBuffer.size());
+    availableWindowSize = std::min<int64_t>(m_cc->getCwnd(),
+                                            m_options.flowControlWindow - m_segmentBuffer.size());
   }
   else {
-    availableWindowSize = static_cast<int64_t>(m_cwnd);
+    availableWindowSize = static_cast<int64_t>(m_cc->getCwnd());
   }
   availableWindowSize -= m_nSegmentsInFlight;
 
@@ -148,7 +173,7 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
       segmentsToRequest.emplace_back(pendingSegmentIt->first, true);
     }
     else if (m_nSegments == 0 || m_nextSegmentNum < static_cast<uint64_t>(m_nSegments)) {
-      if (m_segmentBuffer.count(m_nextSegmentNum) > 0) {
+      if (m_receivedSegments.count(m_nextSegmentNum) > 0) {
         // Don't request a segment a second time if received in response to first "discovery" Interest
         m_nextSegmentNum++;
         continue;
@@ -223,7 +248,7 @@ SegmentFetcher::afterSegmentReceivedCb(const Interest& origInterest, const Data&
 
   // The first received Interest could have any segment ID
   std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt;
-  if (m_receivedSegments.size() > 0) {
+  if (!m_versionedDataName.empty()) {
     pendingSegmentIt = m_pendingSegments.find(currentSegment);
   }
   else {
@@ -262,21 +287,20 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
   m_receivedSegments.insert(currentSegment);
 
   // Add measurement to RTO estimator (if not retransmission)
+  optional<time::nanoseconds> rtt;
   if (pendingSegmentIt->second.state == SegmentState::FirstInterest) {
     BOOST_ASSERT(m_nSegmentsInFlight >= 0);
-    m_rttEstimator.addMeasurement(m_timeLastSegmentReceived - pendingSegmentIt->second.sendTime,
-                                  static_cast<size_t>(m_nSegmentsInFlight) + 1);
+    rtt = m_timeLastSegmentReceived - pendingSegmentIt->second.sendTime;
+    m_rttEstimator.addMeasurement(*rtt, static_cast<size_t>(m_nSegmentsInFlight) + 1);
   }
 
   // Remove from pending segments map
   m_pendingSegments.erase(pendingSegmentIt);
 
-  // Copy data in segment to temporary buffer
-  auto receivedSegmentIt = m_segmentBuffer.emplace(std::piecewise_construct,
-                                                   std::forward_as_tuple(currentSegment),
-                                                   std::forward_as_tuple(data.getContent().value_size()));
-  std::copy(data.getContent().value_begin(), data.getContent().value_end(),
-            receivedSegmentIt.first->second.begin());
+  // Keep the content of the segment, which shares the buffer of the Data packet
+  if (m_options.outputFd < 0) {
+    m_segmentBuffer.emplace(currentSegment, data.getContent());
+  }
   m_nBytesReceived += data.getContent().value_size();
   afterSegmentValidated(data);
 
@@ -292,16 +316,21 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
     }
   }
 
+  if (m_options.outputFd >= 0 && !writeSegment(currentSegment, data.getContent())) {
+    return;
+  }
+
   if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
     do {
-      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
+      const Block& content = m_segmentBuffer[m_nextSegmentInOrder];
+      onInOrderData(std::make_shared<const Buffer>(content.value_begin(), content.value_end()));
       m_segmentBuffer.erase(m_nextSegmentInOrder++);
     } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
   }
 
-  if (m_receivedSegments.size() == 1) {
+  if (m_versionedDataName.empty()) {
     m_versionedDataName = data.getName().getPrefix(-1);
-    if (currentSegment == 0) {
+    if (currentSegment == m_nextSegmentNum) {
       // We received the first segment in response, so we can increment the next segment number
       m_nextSegmentNum++;
     }
@@ -315,7 +344,7 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
     windowDecrease();
   }
   else {
-    windowIncrease();
+    windowIncrease(rtt);
   }
 
   fetchSegmentsInWindow(origInterest);
@@ -395,7 +424,7 @@ SegmentFetcher::afterNackOrTimeout(const Interest& origInterest)
 
   m_rttEstimator.backoffRto();
 
-  if (m_receivedSegments.size() == 0) {
+  if (m_versionedDataName.empty()) {
     // Resend first Interest (until maximum receive timeout exceeded)
     fetchFirstSegment(origInterest, true);
   }
@@ -412,34 +441,128 @@ SegmentFetcher::finalizeFetch()
   if (m_options.inOrder) {
     onInOrderComplete();
   }
+  else if (m_options.outputFd >= 0) {
+    // Drop any segments that were written beyond the end of the object
+    if (::ftruncate(m_options.outputFd, static_cast<off_t>(getContiguousOffset())) != 0) {
+      return signalError(WRITE_ERROR, "Cannot truncate output file: "s + std::strerror(errno));
+    }
+    onFileComplete();
+  }
   else {
-    // Combine segments into final buffer
-    OBufferStream buf;
     // We may have received more segments than exist in the object.
     BOOST_ASSERT(m_receivedSegments.size() >= static_cast<uint64_t>(m_nSegments));
 
+    // Combine segments into a buffer of the final size, copying each segment only once
+    size_t size = 0;
+    for (int64_t i = 0; i < m_nSegments; i++) {
+      size += m_segmentBuffer[i].value_size();
+    }
+    auto buf = std::make_shared<Buffer>(size);
+    auto out = buf->begin();
     for (int64_t i = 0; i < m_nSegments; i++) {
-      buf.write(m_segmentBuffer[i].get<const char>(), m_segmentBuffer[i].size());
+      const Block& content = m_segmentBuffer[i];
+      out = std::copy(content.value_begin(), content.value_end(), out);
     }
-    onComplete(buf.buf());
+    onComplete(buf);
   }
   stop();
 }
 
+uint64_t
+SegmentFetcher::getContiguousOffset() const
+{
+  if (m_nSegments > 0 && m_nextSegmentInOrder == static_cast<uint64_t>(m_nSegments)) {
+    return (m_nextSegmentInOrder - 1) * m_segmentSize + m_lastSegmentSize;
+  }
+  return m_nextSegmentInOrder * m_segmentSize;
+}
+
+bool
+SegmentFetcher::writeSegment(uint64_t segmentNum, const Block& content)
+{
+  bool isLast = m_nSegments > 0 && segmentNum + 1 == static_cast<uint64_t>(m_nSegments);
+  if (m_nSegments > 0 && segmentNum >= static_cast<uint64_t>(m_nSegments)) {
+    // beyond the end of the object
+    return true;
+  }
+
+  if (m_segmentSize == 0 && !isLast) {
+    m_segmentSize = content.value_size();
+    if (m_segmentSize == 0) {
+      signalError(SEGMENT_SIZE_MISMATCH, "Received an empty segment before the last one");
+      return false;
+    }
+
+    // the offsets of the segments kept so far are now known
+    for (auto it = m_segmentBuffer.begin(); it != m_segmentBuffer.end();) {
+      if (!writeSegment(it->first, it->second)) {
+        return false;
+      }
+      it = m_segmentBuffer.erase(it);
+    }
+  }
+
+  if (m_segmentSize == 0 && segmentNum > 0) {
+    // the offset of the last segment is not known until another segment is received
+    m_segmentBuffer.emplace(segmentNum, content);
+    return true;
+  }
+
+  if (isLast ? content.value_size() > m_segmentSize && segmentNum > 0
+             : content.value_size() != m_segmentSize) {
+    signalError(SEGMENT_SIZE_MISMATCH, "Segment " + std::to_string(segmentNum) + " has size " +
+                std::to_string(content.value_size()) + ", expecting " +
+                std::to_string(m_segmentSize));
+    return false;
+  }
+
+  if (!writeAt(segmentNum * m_segmentSize, content)) {
+    return false;
+  }
+  if (isLast) {
+    m_lastSegmentSize = content.value_size();
+  }
+
+  // advance the contiguous prefix; received segments before it are no longer tracked
+  while (m_receivedSegments.count(m_nextSegmentInOrder) > 0 &&
+         m_segmentBuffer.count(m_nextSegmentInOrder) == 0 &&
+         (m_nSegments == 0 || m_nextSegmentInOrder < static_cast<uint64_t>(m_nSegments))) {
+    ++m_nextSegmentInOrder;
+  }
+  m_receivedSegments.erase(m_receivedSegments.begin(),
+                           m_receivedSegments.lower_bound(m_nextSegmentInOrder));
+  return true;
+}
+
+bool
+SegmentFetcher::writeAt(uint64_t offset, const Block& content)
+{
+  const uint8_t* buf = content.value();
+  size_t remaining = content.value_size();
+  while (remaining > 0) {
+    ssize_t n = ::pwrite(m_options.outputFd, buf, remaining, static_cast<off_t>(offset));
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      signalError(WRITE_ERROR, "Cannot write to output file: "s + std::strerror(errno));
+      return false;
+    }
+    buf += n;
+    offset += static_cast<size_t>(n);
+    remaining -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
 void
-SegmentFetcher::windowIncrease()
+SegmentFetcher::windowIncrease(optional<time::nanoseconds> rtt)
 {
   if (m_options.useConstantCwnd) {
-    BOOST_ASSERT(m_cwnd == m_options.initCwnd);
     return;
   }
 
-  if (m_cwnd < m_ssthresh) {
-    m_cwnd += m_options.aiStep; // additive increase
-  }
-  else {
-    m_cwnd += m_options.aiStep / std::floor(m_cwnd); // congestion avoidance
-  }
+  m_cc->onAck(m_timeLastSegmentReceived, rtt);
 }
 
 void
@@ -449,13 +572,10 @@ SegmentFetcher::windowDecrease()
     m_recPoint = m_highInterest;
 
     if (m_options.useConstantCwnd) {
-      BOOST_ASSERT(m_cwnd == m_options.initCwnd);
       return;
     }
 
-    // Refer to RFC 5681, Section 3.1 for the rationale behind the code below
-    m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * m_options.mdCoef); // multiplicative decrease
-    m_cwnd = m_options.resetCwndToInit ? m_options.initCwnd : m_ssthresh;
+    m_cc->onCongestion(time::steady_clock::now());
   }
 }
 
@@ -499,10 +619,12 @@ SegmentFetcher::checkAllSegmentsReceived()
 {
   bool haveReceivedAllSegments = false;
 
-  if (m_nSegments != 0 && m_nReceived >= m_nSegments) {
+  if (m_nSegments != 0 &&
+      static_cast<int64_t>(m_options.resumeSegment) + m_nReceived >= m_nSegments) {
     haveReceivedAllSegments = true;
     // Verify that all segments in window have been received. If not, send Interests for missing segments.
-    for (uint64_t i = 0; i < static_cast<uint64_t>(m_nSegments); i++) {
+    // Segments before m_nextSegmentInOrder have been delivered or written.
+    for (uint64_t i = m_nextSegmentInOrder; i < static_cast<uint64_t>(m_nSegments); i++) {
       if (m_receivedSegments.count(i) == 0) {
         m_retxQueue.push(i);
         haveReceivedAllSegments = false;
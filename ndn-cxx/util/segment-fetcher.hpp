@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/util/congestion-control.hpp"
 #include "ndn-cxx/util/rtt-estimator.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/signal.hpp"
@@ -62,7 +63,9 @@ namespace util {
  * 4. If set to 'block' mode, signal #onComplete passing a memory buffer that combines the content
  *    of all segments in the object. If set to 'in order' mode, signal #onInOrderData is triggered
  *    upon validation of each segment in segment order, storing later segments that arrived out of
- *    order internally until all earlier segments have arrived and have been validated.
+ *    order internally until all earlier segments have arrived and have been validated. If set to
+ *    'file' mode, each segment is written to a file at its offset upon validation, and
+ *    #onFileComplete is signaled once the file contains the whole object.
  *
  * If an error occurs during the fetching process, #onError is signaled with one of the error codes
  * from SegmentFetcher::ErrorCode.
@@ -94,6 +97,10 @@ public:
     NACK_ERROR = 4,
     /// A received FinalBlockId did not contain a segment component
     FINALBLOCKID_NOT_SEGMENT = 5,
+    /// In 'file' mode, a segment other than the last one did not have the size of the others
+    SEGMENT_SIZE_MISMATCH = 6,
+    /// In 'file' mode, writing to the output file failed
+    WRITE_ERROR = 7,
   };
 
   class Options
@@ -119,8 +126,35 @@ public:
     double initSsthresh = std::numeric_limits<double>::max(); ///< initial slow start threshold
     double aiStep = 1.0; ///< additive increase step (in segments)
     double mdCoef = 0.5; ///< multiplicative decrease coefficient
+
+    /**
+     * @brief Creates the congestion control algorithm that manages the Interest window
+     *
+     * If not set, AimdCongestionControl is used, configured with initCwnd, initSsthresh, aiStep,
+     * mdCoef, and resetCwndToInit. useConstantCwnd, disableCwa, and ignoreCongMarks apply to any
+     * algorithm.
+     */
+    std::function<unique_ptr<CongestionControl>(const Options&)> makeCongestionControl;
+
     RttEstimator::Options rttOptions; ///< options for RTT estimator
     size_t flowControlWindow = 25000; ///< maximum number of segments stored in the reorder buffer
+
+    /**
+     * @brief File descriptor to write the object to, enabling 'file' mode if not negative
+     *
+     * Segment N is written at offset `N * <segment size>` with `pwrite`, so that the memory used
+     * by the transfer does not depend on the size of the object. All segments except the last
+     * must have the same size, and the last segment must carry a FinalBlockId. The descriptor is
+     * not closed by SegmentFetcher.
+     */
+    int outputFd = -1;
+
+    /**
+     * @brief In 'file' mode, first segment to fetch, assuming earlier ones are already written
+     *
+     * This resumes an interrupted transfer from the segment given by getNContiguousSegments().
+     */
+    uint64_t resumeSegment = 0;
   };
 
   /**
@@ -159,6 +193,24 @@ public:
   void
   stop();
 
+  /**
+   * @brief Returns the number of leading segments that have been written in 'file' mode.
+   *
+   * An interrupted transfer can be resumed by passing this number in Options::resumeSegment to a
+   * new SegmentFetcher that writes to the same file.
+   */
+  uint64_t
+  getNContiguousSegments() const
+  {
+    return m_nextSegmentInOrder;
+  }
+
+  /**
+   * @brief Returns the length of the fully written prefix of the output file in 'file' mode.
+   */
+  uint64_t
+  getContiguousOffset() const;
+
 private:
   class PendingSegment;
 
@@ -201,11 +253,22 @@ private:
   void
   afterNackOrTimeout(const Interest& origInterest);
 
+  /**
+   * @brief Writes a segment to the output file in 'file' mode, or keeps it until its offset is
+   *        known.
+   * @return false if the transfer failed
+   */
+  bool
+  writeSegment(uint64_t segmentNum, const Block& content);
+
+  bool
+  writeAt(uint64_t offset, const Block& content);
+
   void
   finalizeFetch();
 
   void
-  windowIncrease();
+  windowIncrease(optional<time::nanoseconds> rtt);
 
   void
   windowDecrease();
@@ -273,6 +336,12 @@ public:
    */
   Signal<SegmentFetcher> onInOrderComplete;
 
+  /**
+   * @brief Emitted when the output file contains all segments in 'file' mode.
+   * @note Emitted only if SegmentFetcher is operating in 'file' mode.
+   */
+  Signal<SegmentFetcher> onFileComplete;
+
 private:
   enum class SegmentState {
     FirstInterest, ///< the first Interest for this segment has been sent
@@ -290,7 +359,7 @@ private:
   };
 
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
-  static constexpr double MIN_SSTHRESH = 2.0;
+  static constexpr double MIN_SSTHRESH = CongestionControl::MIN_SSTHRESH;
 
   shared_ptr<SegmentFetcher> m_this;
 
@@ -299,13 +368,12 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Scheduler m_scheduler;
   security::Validator& m_validator;
   RttEstimator m_rttEstimator;
+  unique_ptr<CongestionControl> m_cc;
 
   time::steady_clock::TimePoint m_timeLastSegmentReceived;
   std::queue<uint64_t> m_retxQueue;
   Name m_versionedDataName;
   uint64_t m_nextSegmentNum = 0;
-  double m_cwnd;
-  double m_ssthresh;
   int64_t m_nSegmentsInFlight = 0;
   int64_t m_nSegments = 0;
   uint64_t m_highInterest = 0;
@@ -314,8 +382,10 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   int64_t m_nReceived = 0;
   int64_t m_nBytesReceived = 0;
   uint64_t m_nextSegmentInOrder = 0;
+  uint64_t m_segmentSize = 0;     ///< size of segments except the last one, in 'file' mode
+  uint64_t m_lastSegmentSize = 0; ///< size of the last segment, once written in 'file' mode
 
-  std::map<uint64_t, Buffer> m_segmentBuffer;
+  std::map<uint64_t, Block> m_segmentBuffer; ///< content of received segments, not yet delivered
   std::map<uint64_t, PendingSegment> m_pendingSegments;
   std::set<uint64_t> m_receivedSegments;
 };
@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/util/sha256.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
 #include "ndn-cxx/security/impl/openssl.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
@@ -135,9 +136,12 @@ Sha256::toString()
 ConstBufferPtr
 Sha256::computeDigest(const uint8_t* buffer, size_t size)
 {
-  Sha256 sha256;
-  sha256.update(buffer, size);
-  return sha256.computeDigest();
+  auto digest = make_shared<Buffer>(DIGEST_SIZE);
+  using security::detail::EvpCrypto;
+  if (EvpCrypto::digest(DigestAlgorithm::SHA256, make_span(buffer, size), *digest) != DIGEST_SIZE) {
+    NDN_THROW(Error("Failed to compute SHA-256 digest"));
+  }
+  return digest;
 }
 
 std::ostream&
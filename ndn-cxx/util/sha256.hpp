@@ -160,6 +160,9 @@ public:
    * @param buffer the input buffer
    * @param size the size of the input buffer
    * @return SHA-256 digest of the input buffer
+   *
+   * Unlike the incremental interface, this function computes the digest directly with OpenSSL,
+   * reusing a per-thread context, without going through a transform chain.
    */
   static ConstBufferPtr
   computeDigest(const uint8_t* buffer, size_t size);
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Buffer Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/detail/buffer-pool.hpp"
+#include "ndn-cxx/encoding/encoding-arena.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/interest.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+const int N_ITERATIONS = 1000000;
+
+static void
+printRate(const std::string& what, time::nanoseconds d)
+{
+  std::cout << what << ": " << d << ", "
+            << static_cast<uint64_t>(N_ITERATIONS * 1e9 / d.count()) << " ops/s" << std::endl;
+}
+
+// Compares allocating a zero-filled vector from the heap, which is what Encoder used to do for
+// every packet, with a Buffer recycled from the pool.
+BOOST_AUTO_TEST_CASE(Allocate)
+{
+  size_t nOctets = 0;
+  auto d1 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      auto buf = std::make_shared<std::vector<uint8_t>>(MAX_NDN_PACKET_SIZE);
+      nOctets += buf->size();
+    }
+  });
+  printRate("zero-filled std::vector", d1);
+
+  auto d2 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      auto buf = detail::BufferPool::acquire(MAX_NDN_PACKET_SIZE);
+      nOctets += buf->size();
+    }
+  });
+  printRate("pooled Buffer", d2);
+
+  BOOST_CHECK_EQUAL(nOctets, 2 * N_ITERATIONS * MAX_NDN_PACKET_SIZE);
+}
+
+// Encodes a Data packet into a fresh EncodingBuffer, as Data::wireEncode() does.
+BOOST_AUTO_TEST_CASE(EncodeData)
+{
+  auto data = makeData("/benchmark/buffer/encode/%00%01");
+  data->setContent(std::vector<uint8_t>(1000, 0xbb));
+  signData(data);
+
+  size_t nOctets = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      EncodingBuffer encoder;
+      data->wireEncode(encoder);
+      nOctets += encoder.size();
+    }
+  });
+  printRate("EncodingBuffer + Data::wireEncode", d);
+  BOOST_CHECK_EQUAL(nOctets, N_ITERATIONS * data->wireEncode().size());
+}
+
+// Compares the two-pass encoding that wireEncode() used to perform, i.e., size estimation
+// followed by encoding into an EncodingBuffer of the estimated size, with a single pass into
+// the thread's EncodingArena followed by a copy.
+template<typename Packet>
+static void
+compareEncoding(const Packet& packet, const std::string& what)
+{
+  size_t nOctets = 0;
+  auto d1 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      EncodingEstimator estimator;
+      size_t estimatedSize = packet.wireEncode(estimator);
+      EncodingBuffer encoder(estimatedSize, 0);
+      packet.wireEncode(encoder);
+      nOctets += encoder.block().size();
+    }
+  });
+  printRate(what + " estimator + EncodingBuffer", d1);
+
+  auto d2 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      EncodingArena arena;
+      packet.wireEncode(arena.encoder());
+      nOctets += arena.block().size();
+    }
+  });
+  printRate(what + " EncodingArena", d2);
+
+  BOOST_CHECK_EQUAL(nOctets, 2 * N_ITERATIONS * packet.wireEncode().size());
+}
+
+BOOST_AUTO_TEST_CASE(EncodeInterestArena)
+{
+  Interest interest("/benchmark/buffer/encode/interest/%00%01");
+  interest.setCanBePrefix(true);
+  interest.setMustBeFresh(true);
+  interest.setNonce(0x2a2a2a2a);
+  interest.setInterestLifetime(2_s);
+  compareEncoding(interest, "Interest");
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDataArena)
+{
+  auto data = makeData("/benchmark/buffer/encode/data/%00%01");
+  data->setContent(std::vector<uint8_t>(1000, 0xbb));
+  signData(data);
+  compareEncoding(*data, "Data");
+}
+
+// Copies a received Data packet out of a transport buffer, then decodes it.
+BOOST_AUTO_TEST_CASE(DecodeData)
+{
+  auto data = makeData("/benchmark/buffer/decode/%00%01");
+  data->setContent(std::vector<uint8_t>(1000, 0xbb));
+  signData(data);
+  const Block& wire = data->wireEncode();
+  const std::vector<uint8_t> received(wire.begin(), wire.end());
+
+  size_t nDecoded = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      bool isOk = false;
+      Block block;
+      std::tie(isOk, block) = Block::fromBuffer(received);
+      Data decoded(block);
+      nDecoded += isOk && decoded.getContent().value_size() == 1000;
+    }
+  });
+  printRate("Block::fromBuffer + Data::wireDecode", d);
+  BOOST_CHECK_EQUAL(nDecoded, N_ITERATIONS);
+}
+
+} // namespace tests
+} // namespace ndn
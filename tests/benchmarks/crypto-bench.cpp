@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Crypto Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
+#include "ndn-cxx/security/key-params.hpp"
+#include "ndn-cxx/security/transform/bool-sink.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/digest-filter.hpp"
+#include "ndn-cxx/security/transform/private-key.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/transform/signer-filter.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/security/transform/verifier-filter.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <array>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::security::transform;
+using ndn::security::detail::EvpCrypto;
+
+static void
+report(const std::string& label, size_t nRepeats, time::nanoseconds d)
+{
+  std::cout << label << " " << nRepeats << " times: " << d << ", "
+            << static_cast<uint64_t>(nRepeats * 1e9 / d.count()) << " ops/s" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(Crypto)
+
+// Compares a transform chain with a direct EVP call for SHA-256 digests of various sizes.
+BOOST_AUTO_TEST_CASE(Digest)
+{
+  const size_t nRepeats = 200000;
+
+  for (size_t size : {32, 1024, 8192}) {
+    const std::vector<uint8_t> message(size, 0xAB);
+    std::cout << "SHA-256 of " << size << " octets" << std::endl;
+
+    size_t nOctets = 0;
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < nRepeats; ++i) {
+        OBufferStream os;
+        bufferSource(message) >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(os);
+        nOctets += os.buf()->size();
+      }
+    });
+    BOOST_CHECK_EQUAL(nOctets, nRepeats * 32);
+    report("  transform chain", nRepeats, d);
+
+    nOctets = 0;
+    d = timedExecute([&] {
+      std::array<uint8_t, EvpCrypto::MAX_DIGEST_SIZE> digest;
+      for (size_t i = 0; i < nRepeats; ++i) {
+        nOctets += EvpCrypto::digest(DigestAlgorithm::SHA256, message, digest);
+      }
+    });
+    BOOST_CHECK_EQUAL(nOctets, nRepeats * 32);
+    report("  EvpCrypto", nRepeats, d);
+  }
+}
+
+// Compares a transform chain with a direct EVP call for signing and verifying short messages.
+BOOST_AUTO_TEST_CASE(SignVerify)
+{
+  const size_t nRepeats = 5000;
+  const std::vector<uint8_t> message(256, 0xAB);
+
+  struct Params
+  {
+    const char* name;
+    unique_ptr<PrivateKey> key;
+    KeyType keyType;
+    DigestAlgorithm digestAlgo;
+  };
+  Params params[] = {
+    {"ECDSA P-256", generatePrivateKey(EcKeyParams()), KeyType::EC, DigestAlgorithm::SHA256},
+    {"SM2", generatePrivateKey(sm2KeyParams()), KeyType::SM2, DigestAlgorithm::SM3},
+  };
+
+  for (auto& p : params) {
+    PublicKey publicKey;
+    publicKey.loadPkcs8(*p.key->derivePublicKey());
+    if (p.keyType == KeyType::SM2) {
+      p.key->setSm2Alias();
+      publicKey.setSm2Alias();
+    }
+    std::cout << p.name << std::endl;
+
+    std::vector<ConstBufferPtr> sigs(nRepeats);
+    auto d = timedExecute([&] {
+      for (auto& sig : sigs) {
+        OBufferStream os;
+        bufferSource(message) >> signerFilter(p.digestAlgo, *p.key, p.keyType) >> streamSink(os);
+        sig = os.buf();
+      }
+    });
+    report("  sign, transform chain", nRepeats, d);
+
+    size_t nSigned = 0;
+    d = timedExecute([&] {
+      std::array<uint8_t, 512> sig;
+      for (size_t i = 0; i < nRepeats; ++i) {
+        nSigned += EvpCrypto::sign(p.digestAlgo, *p.key, p.keyType, {message}, sig) > 0;
+      }
+    });
+    BOOST_CHECK_EQUAL(nSigned, nRepeats);
+    report("  sign, EvpCrypto", nRepeats, d);
+
+    size_t nValid = 0;
+    d = timedExecute([&] {
+      for (const auto& sig : sigs) {
+        bool result = false;
+        bufferSource(message) >> verifierFilter(p.digestAlgo, publicKey, p.keyType, *sig)
+                              >> boolSink(result);
+        nValid += result;
+      }
+    });
+    BOOST_CHECK_EQUAL(nValid, nRepeats);
+    report("  verify, transform chain", nRepeats, d);
+
+    nValid = 0;
+    d = timedExecute([&] {
+      for (const auto& sig : sigs) {
+        nValid += EvpCrypto::verify(p.digestAlgo, publicKey, p.keyType, {message}, *sig);
+      }
+    });
+    BOOST_CHECK_EQUAL(nValid, nRepeats);
+    report("  verify, EvpCrypto", nRepeats, d);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Crypto
+
+} // namespace tests
+} // namespace ndn
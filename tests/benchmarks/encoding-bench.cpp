@@ -22,8 +22,12 @@
 #define BOOST_TEST_MODULE ndn-cxx Encoding Benchmark
 #include "tests/boost-test.hpp"
 
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/encoding/tlv.hpp"
+#include "ndn-cxx/interest.hpp"
 #include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
 
 #include <boost/mpl/vector.hpp>
 #include <boost/mpl/vector_c.hpp>
@@ -128,6 +132,89 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ReadVarNumber, Test, ReadVarNumberTests)
             << " " << d << std::endl;
 }
 
+static void
+printRate(const std::string& what, int nIterations, time::nanoseconds d)
+{
+  std::cout << what << ": " << d << ", "
+            << static_cast<uint64_t>(nIterations * 1e9 / d.count()) << " ops/s" << std::endl;
+}
+
+// Compares materializing the sub-elements of a Data packet with Block::parse()
+// against iterating over them lazily with ElementRange.
+BOOST_AUTO_TEST_CASE(SubElements)
+{
+  const int N_ITERATIONS = 1000000;
+
+  auto data = makeData("/benchmark/decode/sub-elements/%00%01");
+  const Block& wire = data->wireEncode();
+
+  size_t nParsed = 0;
+  auto d1 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Block copy(wire.getBuffer(), wire.begin(), wire.end(), false);
+      copy.parse();
+      nParsed += copy.elements_size();
+    }
+  });
+  printRate("Block::parse", N_ITERATIONS, d1);
+
+  size_t nIterated = 0;
+  auto d2 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      for (const auto& element : ElementRange(wire)) {
+        nIterated += element.type() != tlv::Invalid;
+      }
+    }
+  });
+  printRate("ElementRange", N_ITERATIONS, d2);
+
+  BOOST_CHECK_EQUAL(nParsed, nIterated);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeData)
+{
+  const int N_ITERATIONS = 1000000;
+
+  auto data = makeData("/benchmark/decode/data/%00%01");
+  data->setContent(std::vector<uint8_t>(1000, 0xbb));
+  signData(data);
+  const Block& wire = data->wireEncode();
+
+  size_t nDecoded = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      ndn::Data decoded(Block(wire.getBuffer(), wire.begin(), wire.end(), false));
+      nDecoded += decoded.getContent().value_size() == 1000;
+    }
+  });
+  printRate("Data::wireDecode", N_ITERATIONS, d);
+  BOOST_CHECK_EQUAL(nDecoded, N_ITERATIONS);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeInterest)
+{
+  const int N_ITERATIONS = 1000000;
+
+  ndn::Interest interest("/benchmark/decode/interest/%00%01");
+  interest.setCanBePrefix(false)
+          .setMustBeFresh(true)
+          .setNonce(0x12345678)
+          .setInterestLifetime(4_s)
+          .setHopLimit(32)
+          .setApplicationParameters(std::vector<uint8_t>(100, 0xaa));
+  const Block wire = interest.wireEncode();
+
+  size_t nDecoded = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      ndn::Interest decoded(Block(wire.getBuffer(), wire.begin(), wire.end(), false));
+      nDecoded += decoded.getHopLimit() == 32;
+    }
+  });
+  printRate("Interest::wireDecode", N_ITERATIONS, d);
+  BOOST_CHECK_EQUAL(nDecoded, N_ITERATIONS);
+}
+
 } // namespace tests
 } // namespace tlv
 } // namespace ndn
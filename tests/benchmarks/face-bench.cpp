@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Face Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+class FaceBenchFixture
+{
+protected:
+  FaceBenchFixture()
+    : keyChain("pib-memory:", "tpm-memory:")
+    , face(io, keyChain, {false, false})
+  {
+  }
+
+protected:
+  boost::asio::io_service io;
+  KeyChain keyChain;
+  util::DummyClientFace face;
+};
+
+BOOST_FIXTURE_TEST_SUITE(DataDispatch, FaceBenchFixture)
+
+// Measures the rate at which incoming Data packets are matched against the pending Interest
+// table, while the table holds a given number of outstanding Interests.
+BOOST_AUTO_TEST_CASE(PendingInterests)
+{
+  const Name prefix("/benchmark/face/data-dispatch");
+  const size_t nData = 10000;
+
+  for (size_t nOutstanding : {1000, 10000, 100000}) {
+    size_t nSatisfied = 0;
+    for (size_t i = 0; i < nOutstanding + nData; ++i) {
+      Interest interest(Name(prefix).appendSegment(i));
+      interest.setInterestLifetime(1_h);
+      face.expressInterest(interest, [&] (auto&&...) { ++nSatisfied; }, nullptr, nullptr);
+    }
+    io.poll();
+    io.reset();
+    BOOST_REQUIRE_EQUAL(face.getNPendingInterests(), nOutstanding + nData);
+
+    std::vector<shared_ptr<Data>> data;
+    data.reserve(nData);
+    for (size_t i = 0; i < nData; ++i) {
+      data.push_back(makeData(Name(prefix).appendSegment(nOutstanding + i)));
+      data.back()->wireEncode();
+    }
+
+    auto d = timedExecute([&] {
+      for (const auto& datum : data) {
+        face.receive(*datum);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nSatisfied, nData);
+    BOOST_CHECK_EQUAL(face.getNPendingInterests(), nOutstanding);
+    std::cout << "outstanding=" << nOutstanding << " dispatch " << nData << " Data: " << d
+              << ", " << static_cast<uint64_t>(nData * 1e9 / d.count()) << " Data/s" << std::endl;
+
+    face.removeAllPendingInterests();
+    io.poll();
+    io.reset();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // DataDispatch
+
+BOOST_FIXTURE_TEST_SUITE(InterestDispatch, FaceBenchFixture)
+
+// Measures the rate at which incoming Interests are dispatched to InterestFilters,
+// as a function of the number of registered filters.
+BOOST_AUTO_TEST_CASE(InterestFilters)
+{
+  const Name prefix("/benchmark/face/interest-dispatch");
+  const size_t nInterests = 10000;
+
+  for (size_t nFilters : {10, 100, 1000, 10000}) {
+    size_t nDispatched = 0;
+    std::vector<ScopedInterestFilterHandle> handles;
+    handles.reserve(nFilters);
+    for (size_t i = 0; i < nFilters; ++i) {
+      Name filterPrefix = Name(prefix).appendNumber(i);
+      // every tenth filter also carries a regular expression
+      auto filter = i % 10 == 0 ? InterestFilter(filterPrefix, "<obj><>")
+                                : InterestFilter(filterPrefix);
+      handles.emplace_back(face.setInterestFilter(filter, [&] (auto&&...) { ++nDispatched; }));
+    }
+    io.poll();
+    io.reset();
+
+    std::vector<Interest> interests;
+    interests.reserve(nInterests);
+    for (size_t i = 0; i < nInterests; ++i) {
+      Name name = Name(prefix).appendNumber(i % nFilters).append("obj").appendSegment(i);
+      interests.emplace_back(name);
+      interests.back().setInterestLifetime(1_h);
+      interests.back().wireEncode();
+    }
+
+    auto d = timedExecute([&] {
+      for (const auto& interest : interests) {
+        face.receive(interest);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nDispatched, nInterests);
+    std::cout << "filters=" << nFilters << " dispatch " << nInterests << " Interests: " << d
+              << ", " << static_cast<uint64_t>(nInterests * 1e9 / d.count()) << " Interests/s"
+              << std::endl;
+
+    handles.clear();
+    face.removeAllPendingInterests();
+    io.poll();
+    io.reset();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // InterestDispatch
+
+} // namespace tests
+} // namespace ndn
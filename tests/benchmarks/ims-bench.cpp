@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx InMemoryStorage Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
+
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+#include <boost/asio/io_service.hpp>
+
+namespace ndn {
+namespace tests {
+
+const size_t N_LOOKUPS = 1000000;
+
+static Name
+makeName(size_t i)
+{
+  return Name("/benchmark/ims").appendNumber(i % 100).appendNumber(i).appendSegment(0);
+}
+
+/**
+ * \brief Measures the latency of lookups in an InMemoryStorage holding \p nEntries packets.
+ *
+ * Exact matches are served by the hash index, CanBePrefix lookups by the ordered index after
+ * checking the prefix index, and misses are rejected by the prefix index.
+ */
+static void
+run(size_t nEntries)
+{
+  InMemoryStoragePersistent ims;
+  for (size_t i = 0; i < nEntries; ++i) {
+    auto data = make_shared<Data>(makeName(i));
+    data->setFreshnessPeriod(1_h);
+    signData(*data);
+    ims.insert(*data);
+  }
+
+  const size_t nInterests = std::min<size_t>(nEntries, 10000);
+  std::vector<Interest> exact, prefix, miss;
+  for (size_t i = 0; i < nInterests; ++i) {
+    size_t id = (i * 7919) % nEntries;
+    exact.emplace_back(makeName(id));
+    prefix.emplace_back(makeName(id).getPrefix(-1));
+    prefix.back().setCanBePrefix(true);
+    miss.emplace_back(Name(makeName(id)).append("missing"));
+    miss.back().setCanBePrefix(true);
+  }
+
+  auto measure = [&] (const std::string& what, const std::vector<Interest>& interests,
+                      size_t nExpected) {
+    size_t nFound = 0;
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < N_LOOKUPS; ++i) {
+        nFound += ims.find(interests[i % interests.size()]) != nullptr;
+      }
+    });
+    BOOST_CHECK_EQUAL(nFound, nExpected);
+    std::cout << nEntries << " entries, " << what << ": " << d
+              << ", " << d.count() / N_LOOKUPS << " ns/lookup" << std::endl;
+  };
+
+  measure("exact", exact, N_LOOKUPS);
+  measure("CanBePrefix", prefix, N_LOOKUPS);
+  measure("miss", miss, 0);
+}
+
+// Measures insertions of packets with a MustBeFresh processing window, and the time to mark
+// all of them as non-fresh once the window has elapsed.
+BOOST_AUTO_TEST_CASE(InsertWithFreshness)
+{
+  const size_t nEntries = 1000000;
+  const auto window = 200_ms;
+
+  std::vector<shared_ptr<Data>> packets;
+  packets.reserve(nEntries);
+  for (size_t i = 0; i < nEntries; ++i) {
+    packets.push_back(make_shared<Data>(makeName(i)));
+    packets.back()->setFreshnessPeriod(1_h);
+    signData(*packets.back());
+  }
+
+  boost::asio::io_service io;
+  InMemoryStoragePersistent ims(io);
+  auto d = timedExecute([&] {
+    for (const auto& data : packets) {
+      ims.insert(*data, window);
+    }
+  });
+  std::cout << nEntries << " insertions with freshness: " << d
+            << ", " << static_cast<uint64_t>(nEntries * 1e9 / d.count()) << " insertions/s"
+            << std::endl;
+
+  d = timedExecute([&] { io.run(); });
+  std::cout << "waiting for " << window << " and marking " << nEntries << " entries as stale: "
+            << d << std::endl;
+
+  Interest interest("/benchmark/ims");
+  interest.setCanBePrefix(true);
+  interest.setMustBeFresh(true);
+  BOOST_CHECK(ims.find(interest) == nullptr);
+}
+
+// Measures the throughput of an InMemoryStorageSharded accessed by several threads, each of
+// which performs one insertion for every nine exact-match lookups.
+BOOST_AUTO_TEST_CASE(ShardedConcurrent)
+{
+  const size_t nEntries = 100000;
+  const size_t nOpsPerThread = 200000;
+  const size_t nShards = 16;
+
+  // packets and Interests are prepared in advance, and shared read-only by the threads
+  std::vector<shared_ptr<Data>> packets;
+  std::vector<Interest> interests;
+  packets.reserve(nEntries);
+  interests.reserve(nEntries);
+  for (size_t i = 0; i < nEntries; ++i) {
+    packets.push_back(make_shared<Data>(makeName(i)));
+    packets.back()->setFreshnessPeriod(1_h);
+    signData(*packets.back());
+    interests.emplace_back(makeName(i));
+  }
+
+  for (size_t nThreads : {1, 2, 4, 8}) {
+    InMemoryStorageSharded ims(nShards, [] { return make_unique<InMemoryStoragePersistent>(); });
+    for (const auto& data : packets) {
+      ims.insert(*data);
+    }
+
+    std::vector<size_t> nFound(nThreads);
+    auto d = timedExecute([&] {
+      std::vector<std::thread> threads;
+      for (size_t t = 0; t < nThreads; ++t) {
+        threads.emplace_back([&, t] {
+          for (size_t i = 0; i < nOpsPerThread; ++i) {
+            size_t id = (i * 7919 + t * 104729) % nEntries;
+            if (i % 10 == 0) {
+              ims.insert(*packets[id]);
+            }
+            else {
+              nFound[t] += ims.find(interests[id]) != nullptr;
+            }
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    });
+
+    size_t nWrites = nThreads * (nOpsPerThread / 10);
+    size_t nReads = nThreads * nOpsPerThread - nWrites;
+    BOOST_CHECK_EQUAL(std::accumulate(nFound.begin(), nFound.end(), size_t(0)), nReads);
+    std::cout << nThreads << " threads, " << nShards << " shards: " << d
+              << ", " << static_cast<uint64_t>(nReads * 1e9 / d.count()) << " reads/s"
+              << ", " << static_cast<uint64_t>(nWrites * 1e9 / d.count()) << " writes/s"
+              << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Lookup10k)
+{
+  run(10000);
+}
+
+BOOST_AUTO_TEST_CASE(Lookup1M)
+{
+  run(1000000);
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Name Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/name.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <unordered_set>
+
+// Count heap allocations by replacing the global allocation functions. The replacements are
+// not inlined, so that the compiler never pairs a new-expression with the std::free() below.
+static std::atomic<size_t> g_nAllocations{0};
+
+__attribute__((noinline)) void*
+operator new(std::size_t size)
+{
+  ++g_nAllocations;
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+__attribute__((noinline)) void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+__attribute__((noinline)) void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace ndn {
+namespace tests {
+
+const int N_ITERATIONS = 1000000;
+
+template<typename F>
+static void
+run(const std::string& what, const F& f)
+{
+  size_t nComponents = 0;
+  size_t nAllocationsBefore = g_nAllocations;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      nComponents += f(i).size();
+    }
+  });
+  size_t nAllocations = g_nAllocations - nAllocationsBefore;
+
+  BOOST_CHECK_GT(nComponents, 0);
+  std::cout << what << ": " << d
+            << ", " << static_cast<uint64_t>(N_ITERATIONS * 1e9 / d.count()) << " names/s"
+            << ", " << static_cast<double>(nAllocations) / N_ITERATIONS << " allocations/name"
+            << std::endl;
+}
+
+// Measures construction throughput and heap allocations of names built the way
+// producers and SegmentFetcher build them.
+BOOST_AUTO_TEST_CASE(Construction)
+{
+  const Name prefix("/benchmark/name/construction");
+
+  run("appendSegment", [&] (int i) {
+    return Name(prefix).appendSegment(static_cast<uint64_t>(i));
+  });
+
+  run("appendVersion+appendSegment", [&] (int i) {
+    return Name(prefix).appendVersion(1).appendSegment(static_cast<uint64_t>(i));
+  });
+
+  run("append x8", [] (int i) {
+    Name name;
+    name.append("localhost").append("benchmark").append("name").append("construction")
+        .append("eight").append("generic").appendNumber(static_cast<uint64_t>(i))
+        .appendSequenceNumber(static_cast<uint64_t>(i));
+    return name;
+  });
+
+  run("from URI", [] (int) {
+    return Name("/localhost/benchmark/name/construction/from/uri/seg=1/seq=2");
+  });
+
+  run("getPrefix", [&] (int) {
+    return prefix.getPrefix(-1);
+  });
+}
+
+// Measures lookups in an unordered set of names, as done with the names of certificates
+// already seen during validation, where the looked-up names are reused across lookups.
+BOOST_AUTO_TEST_CASE(UnorderedSetLookup)
+{
+  const size_t nNames = 10000;
+  std::unordered_set<Name> set;
+  std::vector<Name> names;
+  names.reserve(nNames);
+  for (size_t i = 0; i < nNames; ++i) {
+    names.push_back(Name("/benchmark/name/lookup/KEY").appendNumber(i)
+                                                      .append("self").appendVersion(i));
+    set.insert(names.back());
+  }
+
+  size_t nFound = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      nFound += set.count(names[static_cast<size_t>(i) % nNames]);
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nFound, N_ITERATIONS);
+  std::cout << "unordered_set<Name> lookup: " << d
+            << ", " << static_cast<uint64_t>(N_ITERATIONS * 1e9 / d.count()) << " lookups/s"
+            << std::endl;
+}
+
+} // namespace tests
+} // namespace ndn
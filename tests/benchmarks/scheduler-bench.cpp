@@ -34,17 +34,24 @@ namespace tests {
 
 using namespace ndn::tests;
 
-BOOST_AUTO_TEST_CASE(ScheduleCancel)
+static std::ostream&
+operator<<(std::ostream& os, Scheduler::Backend backend)
+{
+  return os << (backend == Scheduler::Backend::TREE ? "tree" : "timer wheel");
+}
+
+static void
+runScheduleCancel(Scheduler::Backend backend, size_t nEvents)
 {
   boost::asio::io_service io;
-  Scheduler sched(io);
+  Scheduler sched(io, backend);
 
-  const size_t nEvents = 1000000;
   std::vector<EventId> eventIds(nEvents);
 
+  // delays are spread over one minute, as with Interest lifetimes and freshness periods
   auto d1 = timedExecute([&] {
     for (size_t i = 0; i < nEvents; ++i) {
-      eventIds[i] = sched.schedule(1_s, []{});
+      eventIds[i] = sched.schedule(1_s + time::microseconds(i % 60000000), []{});
     }
   });
 
@@ -54,36 +61,66 @@ BOOST_AUTO_TEST_CASE(ScheduleCancel)
     }
   });
 
-  std::cout << "schedule " << nEvents << " events: " << d1 << std::endl;
-  std::cout << "cancel " << nEvents << " events: " << d2 << std::endl;
+  std::cout << backend << ": schedule " << nEvents << " events: " << d1 << std::endl;
+  std::cout << backend << ": cancel " << nEvents << " events: " << d2 << std::endl;
 }
 
-BOOST_AUTO_TEST_CASE(Execute)
+static void
+runExecute(Scheduler::Backend backend, size_t nEvents)
 {
   boost::asio::io_service io;
-  Scheduler sched(io);
+  Scheduler sched(io, backend);
 
-  const size_t nEvents = 1000000;
   size_t nExpired = 0;
 
   // Events should expire at t1, but execution finishes at t2. The difference is the overhead.
-  time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s;
+  time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s * (nEvents / 1000000);
   time::steady_clock::TimePoint t2;
-  // +1ms ensures this extra event is executed last. In case the overhead is less than 1ms,
-  // it will be reported as 1ms.
-  sched.schedule(t1 - time::steady_clock::now() + 1_ms, [&] {
-    t2 = time::steady_clock::now();
-    BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  });
 
   for (size_t i = 0; i < nEvents; ++i) {
-    sched.schedule(t1 - time::steady_clock::now(), [&] { ++nExpired; });
+    sched.schedule(t1 - time::steady_clock::now(), [&] {
+      if (++nExpired == nEvents) {
+        t2 = time::steady_clock::now();
+      }
+    });
   }
 
   io.run();
 
   BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  std::cout << "execute " << nEvents << " events: " << (t2 - t1) << std::endl;
+  std::cout << backend << ": execute " << nEvents << " events: " << (t2 - t1)
+            << ", " << sched.getCounters().nWakeups << " wakeups" << std::endl;
+}
+
+const std::vector<Scheduler::Backend> BACKENDS{Scheduler::Backend::TREE,
+                                               Scheduler::Backend::TIMER_WHEEL};
+
+BOOST_AUTO_TEST_CASE(ScheduleCancel)
+{
+  for (auto backend : BACKENDS) {
+    runScheduleCancel(backend, 1000000);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleCancel10M)
+{
+  for (auto backend : BACKENDS) {
+    runScheduleCancel(backend, 10000000);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Execute)
+{
+  for (auto backend : BACKENDS) {
+    runExecute(backend, 1000000);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Execute10M)
+{
+  for (auto backend : BACKENDS) {
+    runExecute(backend, 10000000);
+  }
 }
 
 } // namespace tests
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Signing Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::security;
+
+class SigningBenchFixture
+{
+protected:
+  SigningBenchFixture()
+    : keyChain("pib-memory:", "tpm-memory:")
+  {
+  }
+
+  static std::vector<Data>
+  makeSegments(const Name& prefix, size_t nSegments, size_t payloadSize = 1024)
+  {
+    std::vector<Data> segments;
+    segments.reserve(nSegments);
+    const std::vector<uint8_t> payload(payloadSize, 0xAB);
+    for (size_t i = 0; i < nSegments; ++i) {
+      segments.emplace_back(Name(prefix).appendSegment(i));
+      segments.back().setContent(payload);
+    }
+    return segments;
+  }
+
+  /**
+   * \brief Sign \p nSegments Data packets with a key of type \p keyParams, one at a time and
+   *        in batches with several thread counts, and report the signing rate.
+   */
+  void
+  run(const std::string& keyTypeName, const KeyParams& keyParams, size_t nSegments)
+  {
+    Identity identity = keyChain.createIdentity("/benchmark/signing/" + keyTypeName, keyParams);
+    auto signingInfo = signingByIdentity(identity);
+
+    auto segments = makeSegments(identity.getName(), nSegments);
+    auto d = timedExecute([&] {
+      for (auto& segment : segments) {
+        keyChain.sign(segment, signingInfo);
+      }
+    });
+    std::cout << keyTypeName << " sign " << nSegments << " Data one at a time: " << d << ", "
+              << static_cast<uint64_t>(nSegments * 1e9 / d.count()) << " signatures/s"
+              << std::endl;
+
+    for (size_t nThreads : {1, 2, 4, 8}) {
+      segments = makeSegments(identity.getName(), nSegments);
+      d = timedExecute([&] {
+        keyChain.signBatch(segments, signingInfo, nThreads);
+      });
+      BOOST_CHECK(segments.back().getSignatureValue().isValid());
+      std::cout << keyTypeName << " signBatch " << nSegments << " Data with " << nThreads
+                << " threads: " << d << ", "
+                << static_cast<uint64_t>(nSegments * 1e9 / d.count()) << " signatures/s"
+                << std::endl;
+    }
+  }
+
+protected:
+  KeyChain keyChain;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Signing, SigningBenchFixture)
+
+// Measures the rate at which segments of a file are signed with each signature algorithm.
+BOOST_AUTO_TEST_CASE(Segments)
+{
+  const size_t nSegments = 5000;
+
+  run("ECDSA", EcKeyParams(), nSegments);
+  run("RSA", RsaKeyParams(), nSegments);
+  run("SM2", sm2KeyParams(), nSegments);
+}
+
+// Measures the signing rate of Data packets whose content ranges from a few bytes to more than
+// the default capacity of an EncodingBuffer, where encoding and copying dominate.
+BOOST_AUTO_TEST_CASE(PayloadSize)
+{
+  const size_t nSegments = 20000;
+  auto signingInfo = signingWithSha256();
+
+  for (size_t payloadSize : {10, 1024, 8000, 65536}) {
+    auto segments = makeSegments("/benchmark/signing/payload", nSegments, payloadSize);
+    auto d = timedExecute([&] {
+      for (auto& segment : segments) {
+        keyChain.sign(segment, signingInfo);
+      }
+    });
+    size_t nBufferBytes = 0;
+    for (const auto& segment : segments) {
+      nBufferBytes += segment.wireEncode().getBuffer()->size();
+    }
+    std::cout << "DigestSha256 sign " << nSegments << " Data with " << payloadSize
+              << "-byte payload: " << d << ", "
+              << static_cast<uint64_t>(nSegments * 1e9 / d.count()) << " signatures/s, "
+              << nBufferBytes / nSegments << " bytes of buffer per packet" << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Signing
+
+} // namespace tests
+} // namespace ndn
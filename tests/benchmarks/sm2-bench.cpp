@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx SM2 Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/key-params.hpp"
+#include "ndn-cxx/security/transform/bool-sink.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/private-key.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/transform/signer-filter.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/security/transform/verifier-filter.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::security::transform;
+
+class Sm2BenchFixture
+{
+protected:
+  Sm2BenchFixture()
+    : message(1024, 0xAB)
+  {
+    privateKey = generatePrivateKey(sm2KeyParams());
+    auto keyBits = privateKey->derivePublicKey();
+    publicKey.loadPkcs8(*keyBits);
+  }
+
+  ConstBufferPtr
+  sign() const
+  {
+    OBufferStream os;
+    bufferSource(message) >> signerFilter(DigestAlgorithm::SM3, *privateKey, KeyType::SM2)
+                          >> streamSink(os);
+    return os.buf();
+  }
+
+  bool
+  verify(const Buffer& sig) const
+  {
+    bool result = false;
+    bufferSource(message) >> verifierFilter(DigestAlgorithm::SM3, publicKey, KeyType::SM2, sig)
+                          >> boolSink(result);
+    return result;
+  }
+
+  /**
+   * \brief Sign and verify \p nMessages messages, and report the rates.
+   */
+  void
+  run(const std::string& label, size_t nMessages)
+  {
+    std::vector<ConstBufferPtr> sigs(nMessages);
+    auto d = timedExecute([&] {
+      for (auto& sig : sigs) {
+        sig = sign();
+      }
+    });
+    std::cout << label << " sign " << nMessages << " messages: " << d << ", "
+              << static_cast<uint64_t>(nMessages * 1e9 / d.count()) << " signatures/s"
+              << std::endl;
+
+    size_t nValid = 0;
+    d = timedExecute([&] {
+      for (const auto& sig : sigs) {
+        nValid += verify(*sig);
+      }
+    });
+    BOOST_CHECK_EQUAL(nValid, nMessages);
+    std::cout << label << " verify " << nMessages << " messages: " << d << ", "
+              << static_cast<uint64_t>(nMessages * 1e9 / d.count()) << " verifications/s"
+              << std::endl;
+  }
+
+protected:
+  const std::vector<uint8_t> message;
+  unique_ptr<PrivateKey> privateKey;
+  PublicKey publicKey;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Sm2, Sm2BenchFixture)
+
+// Compares setting up an SM2 context for each message, which computes the Z value every time,
+// with copying a context prepared once per key.
+BOOST_AUTO_TEST_CASE(SignVerify)
+{
+  const size_t nMessages = 5000;
+
+  run("per-message context", nMessages);
+
+  privateKey->setSm2Alias();
+  publicKey.setSm2Alias();
+  run("precomputed context", nMessages);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Sm2
+
+} // namespace tests
+} // namespace ndn
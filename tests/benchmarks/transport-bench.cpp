@@ -0,0 +1,325 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Transport Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/tlv.hpp"
+#include "ndn-cxx/transport/unix-transport.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/filesystem.hpp>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using boost::asio::local::stream_protocol;
+
+/**
+ * \brief Return the sequence number carried by a packet of this benchmark.
+ *
+ * Each packet carries its sequence number, modulo the number of distinct packets, as a 64-bit
+ * big-endian integer at the beginning of its TLV-VALUE.
+ */
+static uint64_t
+readSequence(const uint8_t* value)
+{
+  uint64_t seq = 0;
+  std::memcpy(&seq, value, sizeof(seq));
+  return boost::endian::big_to_native(seq);
+}
+
+static std::vector<Block>
+makePackets(size_t nDistinct, size_t packetSize)
+{
+  std::vector<Block> packets;
+  packets.reserve(nDistinct);
+  for (size_t i = 0; i < nDistinct; ++i) {
+    std::vector<uint8_t> value(packetSize);
+    uint64_t seq = boost::endian::native_to_big(static_cast<uint64_t>(i));
+    std::memcpy(value.data(), &seq, sizeof(seq));
+    packets.push_back(makeBinaryBlock(tlv::Content, value));
+  }
+  return packets;
+}
+
+/**
+ * \brief A stand-in forwarder that accepts one Unix stream connection, consumes and checks
+ *        the order of the packets sent by the benchmark, and optionally sends packets back.
+ */
+class StandInForwarder
+{
+public:
+  StandInForwarder(boost::asio::io_service& io, const std::string& path, size_t nDistinct)
+    : m_acceptor(io, stream_protocol::endpoint(path))
+    , m_socket(io)
+    , m_nDistinct(nDistinct)
+  {
+    m_acceptor.async_accept(m_socket, [this] (const auto& error) {
+      BOOST_REQUIRE(!error);
+      this->receive();
+      this->send();
+    });
+  }
+
+  /**
+   * \brief Send \p nPackets packets, cycling through \p packets, once the connection is accepted.
+   */
+  void
+  sendAfterAccept(const std::vector<Block>& packets, size_t nPackets)
+  {
+    m_packetsToSend = &packets;
+    m_nPacketsToSend = nPackets;
+  }
+
+  size_t
+  getNReceived() const
+  {
+    return m_nReceived;
+  }
+
+  size_t
+  getNOutOfOrder() const
+  {
+    return m_nOutOfOrder;
+  }
+
+private:
+  void
+  receive()
+  {
+    m_socket.async_receive(boost::asio::buffer(m_buffer.data() + m_size, m_buffer.size() - m_size),
+      [this] (const auto& error, size_t nBytes) {
+        if (error) {
+          return;
+        }
+        m_size += nBytes;
+        this->consume();
+        this->receive();
+      });
+  }
+
+  void
+  send()
+  {
+    if (m_nSent >= m_nPacketsToSend) {
+      return;
+    }
+
+    m_sendBuffers.clear();
+    for (size_t i = 0; i < 64 && m_nSent < m_nPacketsToSend; ++i, ++m_nSent) {
+      m_sendBuffers.push_back((*m_packetsToSend)[m_nSent % m_packetsToSend->size()]);
+    }
+    boost::asio::async_write(m_socket, m_sendBuffers, [this] (const auto& error, size_t) {
+      if (!error) {
+        this->send();
+      }
+    });
+  }
+
+  void
+  consume()
+  {
+    const uint8_t* pos = m_buffer.data();
+    const uint8_t* const end = pos + m_size;
+    while (pos < end) {
+      const uint8_t* next = pos;
+      uint32_t type = 0;
+      uint64_t length = 0;
+      if (!tlv::readType(next, end, type) || !tlv::readVarNumber(next, end, length) ||
+          static_cast<uint64_t>(end - next) < length) {
+        break;
+      }
+
+      if (readSequence(next) != m_nReceived % m_nDistinct) {
+        ++m_nOutOfOrder;
+      }
+      ++m_nReceived;
+      pos = next + length;
+    }
+
+    m_size = static_cast<size_t>(end - pos);
+    std::memmove(m_buffer.data(), pos, m_size);
+  }
+
+private:
+  stream_protocol::acceptor m_acceptor;
+  stream_protocol::socket m_socket;
+  std::array<uint8_t, 1 << 20> m_buffer;
+  size_t m_size = 0;
+  size_t m_nDistinct;
+  size_t m_nReceived = 0;
+  size_t m_nOutOfOrder = 0;
+  const std::vector<Block>* m_packetsToSend = nullptr;
+  size_t m_nPacketsToSend = 0;
+  size_t m_nSent = 0;
+  std::vector<boost::asio::const_buffer> m_sendBuffers;
+};
+
+class TransportBenchFixture
+{
+protected:
+  TransportBenchFixture()
+    : m_path(boost::filesystem::temp_directory_path() /
+             boost::filesystem::unique_path("ndn-cxx-transport-bench-%%%%-%%%%.sock"))
+  {
+  }
+
+  ~TransportBenchFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove(m_path, ec);
+  }
+
+  /**
+   * \brief Send \p nPackets packets of \p packetSize octets in bursts of \p burstSize packets,
+   *        and report the time until the stand-in forwarder has received all of them.
+   */
+  void
+  run(size_t maxWriteBatchSize, size_t nPackets, size_t packetSize, size_t burstSize)
+  {
+    boost::filesystem::remove(m_path);
+    boost::asio::io_service io;
+
+    const size_t nDistinct = 1024;
+    StandInForwarder forwarder(io, m_path.string(), nDistinct);
+    auto packets = makePackets(nDistinct, packetSize);
+
+    UnixTransport transport(m_path.string());
+    transport.setMaxWriteBatchSize(maxWriteBatchSize);
+    transport.connect(io, [] (const Block&) {});
+
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < nPackets; ) {
+        for (size_t j = 0; j < burstSize && i < nPackets; ++j, ++i) {
+          transport.send(packets[i % nDistinct]);
+        }
+        io.poll();
+        io.reset();
+      }
+      while (forwarder.getNReceived() < nPackets) {
+        io.run_one();
+      }
+    });
+
+    BOOST_CHECK_EQUAL(forwarder.getNReceived(), nPackets);
+    BOOST_CHECK_EQUAL(forwarder.getNOutOfOrder(), 0);
+
+    const auto& counters = transport.getWriteCounters();
+    std::cout << "maxWriteBatchSize=" << maxWriteBatchSize
+              << " packetSize=" << packetSize << " burst=" << burstSize
+              << " send " << nPackets << " packets: " << d
+              << ", " << static_cast<uint64_t>(nPackets * 1e9 / d.count()) << " packets/s"
+              << ", " << counters.nBatches << " writes"
+              << ", avg " << static_cast<double>(counters.nPackets) / counters.nBatches
+              << " max " << counters.maxBatchPackets << " packets/write" << std::endl;
+
+    transport.close();
+  }
+
+  /**
+   * \brief Receive \p nPackets packets of \p packetSize octets from the stand-in forwarder,
+   *        and report the time until all of them have been delivered to the receive callback.
+   */
+  void
+  receive(Transport::ReceiveMode mode, size_t nPackets, size_t packetSize)
+  {
+    boost::filesystem::remove(m_path);
+    boost::asio::io_service io;
+
+    const size_t nDistinct = 1024;
+    StandInForwarder forwarder(io, m_path.string(), nDistinct);
+    auto packets = makePackets(nDistinct, packetSize);
+    forwarder.sendAfterAccept(packets, nPackets);
+
+    size_t nReceived = 0;
+    size_t nOutOfOrder = 0;
+    UnixTransport transport(m_path.string());
+    transport.setReceiveMode(mode);
+    transport.connect(io, [&] (const Block& wire) {
+      if (wire.value_size() < sizeof(uint64_t) ||
+          readSequence(wire.value()) != nReceived % nDistinct) {
+        ++nOutOfOrder;
+      }
+      ++nReceived;
+    });
+    // the transport starts receiving once connected, if it has something to send
+    transport.send(packets.front());
+
+    auto d = timedExecute([&] {
+      while (nReceived < nPackets) {
+        io.run_one();
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nReceived, nPackets);
+    BOOST_CHECK_EQUAL(nOutOfOrder, 0);
+    std::cout << "receiveMode=" << (mode == Transport::ReceiveMode::COPY ? "copy" : "shared-chunk")
+              << " packetSize=" << packetSize
+              << " receive " << nPackets << " packets: " << d
+              << ", " << static_cast<uint64_t>(nPackets * 1e9 / d.count()) << " packets/s"
+              << std::endl;
+
+    transport.close();
+  }
+
+private:
+  boost::filesystem::path m_path;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UnixLoopback, TransportBenchFixture)
+
+// Benchmark of UnixTransport write throughput towards a local stand-in forwarder,
+// with and without coalescing of queued packets into vectored writes.
+BOOST_AUTO_TEST_CASE(SendThroughput)
+{
+  const size_t nPackets = 100000;
+
+  for (size_t packetSize : {100, 1000, 8000}) {
+    for (size_t burstSize : {1, 16, 256}) {
+      run(0, nPackets, packetSize, burstSize);
+      run(65536, nPackets, packetSize, burstSize);
+    }
+  }
+}
+
+// Benchmark of UnixTransport receive throughput from a local stand-in forwarder,
+// copying each packet into its own buffer versus sharing receive chunks.
+BOOST_AUTO_TEST_CASE(ReceiveThroughput)
+{
+  const size_t nPackets = 100000;
+
+  for (size_t packetSize : {100, 1000, 8000}) {
+    receive(Transport::ReceiveMode::COPY, nPackets, packetSize);
+    receive(Transport::ReceiveMode::SHARED_CHUNK, nPackets, packetSize);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // UnixLoopback
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Validation Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
+#include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::security;
+
+class ValidationBenchFixture
+{
+protected:
+  ValidationBenchFixture()
+    : keyChain("pib-memory:", "tpm-memory:")
+  {
+  }
+
+  /**
+   * \brief Validate \p nData Data packets signed by a trust anchor with a key of type
+   *        \p keyParams, with and without the parsed public key cache of the Validator.
+   */
+  void
+  run(const std::string& keyTypeName, const KeyParams& keyParams, size_t nData)
+  {
+    Identity identity = keyChain.createIdentity("/benchmark/validation/" + keyTypeName, keyParams);
+    Certificate cert = identity.getDefaultKey().getDefaultCertificate();
+
+    std::vector<Data> data;
+    data.reserve(nData);
+    for (size_t i = 0; i < nData; ++i) {
+      data.emplace_back(Name(identity.getName()).append("data").appendSegment(i));
+      keyChain.sign(data.back(), signingByIdentity(identity));
+    }
+
+    size_t nUncached = 0;
+    auto uncached = timedExecute([&] {
+      optional<Certificate> trustedCert(cert);
+      for (const auto& datum : data) {
+        nUncached += verifySignature(datum, trustedCert);
+      }
+    });
+
+    Validator validator(make_unique<ValidationPolicySimpleHierarchy>(),
+                        make_unique<CertificateFetcherOffline>());
+    validator.loadAnchor("", Certificate(cert));
+    size_t nCached = 0;
+    auto cached = timedExecute([&] {
+      for (const auto& datum : data) {
+        validator.validate(datum, [&] (const Data&) { ++nCached; }, [] (auto&&...) {});
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nUncached, nData);
+    BOOST_CHECK_EQUAL(nCached, nData);
+    std::cout << keyTypeName << " validate " << nData << " Data: "
+              << "parse key every time " << uncached << ", "
+              << static_cast<uint64_t>(nData * 1e9 / uncached.count()) << " Data/s; "
+              << "Validator with key cache " << cached << ", "
+              << static_cast<uint64_t>(nData * 1e9 / cached.count()) << " Data/s" << std::endl;
+
+    for (size_t nThreads : {1, 2, 4}) {
+      validator.setVerificationThreads(nThreads);
+      size_t nBatched = 0;
+      auto batched = timedExecute([&] {
+        validator.validateBatch(data, [&] (const Data&) { ++nBatched; }, [] (auto&&...) {});
+      });
+
+      BOOST_CHECK_EQUAL(nBatched, nData);
+      std::cout << keyTypeName << " validateBatch " << nData << " Data with " << nThreads
+                << " threads: " << batched << ", "
+                << static_cast<uint64_t>(nData * 1e9 / batched.count()) << " Data/s" << std::endl;
+    }
+  }
+
+protected:
+  KeyChain keyChain;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Validation, ValidationBenchFixture)
+
+// Measures the rate at which Data packets signed directly by a trust anchor are validated,
+// which is dominated by public key operations, one at a time and in batches.
+BOOST_AUTO_TEST_CASE(DataSignedByAnchor)
+{
+  const size_t nData = 2000;
+
+  run("ECDSA", EcKeyParams(), nData);
+  run("RSA", RsaKeyParams(), nData);
+  run("SM2", sm2KeyParams(), nData);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Validation
+
+} // namespace tests
+} // namespace ndn
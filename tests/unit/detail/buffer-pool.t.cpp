@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/buffer-pool.hpp"
+#include "ndn-cxx/encoding/block.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <thread>
+
+namespace ndn {
+namespace detail {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Detail)
+BOOST_AUTO_TEST_SUITE(TestBufferPool)
+
+BOOST_AUTO_TEST_CASE(Reuse)
+{
+  auto buf1 = BufferPool::acquire(1000);
+  BOOST_CHECK_EQUAL(buf1->size(), 1000);
+  const Buffer* addr1 = buf1.get();
+  std::fill(buf1->begin(), buf1->end(), 0xaa);
+  buf1.reset();
+
+  // an unreferenced buffer serves the next request of the same size class, with the
+  // exact size requested; octets beyond the previous size are zero-filled
+  auto buf2 = BufferPool::acquire(1200);
+  BOOST_CHECK_EQUAL(buf2.get(), addr1);
+  BOOST_CHECK_EQUAL(buf2->size(), 1200);
+  BOOST_CHECK_EQUAL((*buf2)[999], 0xaa);
+  BOOST_CHECK_EQUAL((*buf2)[1000], 0x00);
+
+  // but not a request of another size class
+  buf2.reset();
+  auto buf3 = BufferPool::acquire(100);
+  BOOST_CHECK_NE(buf3.get(), addr1);
+}
+
+BOOST_AUTO_TEST_CASE(InUse)
+{
+  auto buf1 = BufferPool::acquire(20);
+  std::fill(buf1->begin(), buf1->end(), 0x01);
+  (*buf1)[0] = 0x08;
+  (*buf1)[1] = 18;
+  Block block(buf1);
+  const Buffer* addr1 = buf1.get();
+  buf1.reset();
+
+  // a buffer still referenced by a Block is not recycled
+  auto buf2 = BufferPool::acquire(20);
+  BOOST_CHECK_NE(buf2.get(), addr1);
+  BOOST_CHECK_EQUAL(block.value_size(), 18);
+  BOOST_CHECK_EQUAL(block.value()[0], 0x01);
+}
+
+BOOST_AUTO_TEST_CASE(Large)
+{
+  auto buf1 = BufferPool::acquire(BufferPool::MAX_POOLED_SIZE + 1);
+  BOOST_CHECK_EQUAL(buf1->size(), BufferPool::MAX_POOLED_SIZE + 1);
+  const Buffer* addr1 = buf1.get();
+  buf1.reset();
+
+  // large requests bypass the pool; buf2 keeps the memory of buf1 from being reused by buf3
+  auto buf2 = BufferPool::acquire(BufferPool::MAX_POOLED_SIZE + 1);
+  auto buf3 = BufferPool::acquire(BufferPool::MAX_POOLED_SIZE);
+  BOOST_CHECK_NE(buf3.get(), addr1);
+  BOOST_CHECK_EQUAL(buf3->size(), BufferPool::MAX_POOLED_SIZE);
+}
+
+BOOST_AUTO_TEST_CASE(OtherThread)
+{
+  // the pool of a new thread is empty
+  std::thread thread([] {
+    std::vector<shared_ptr<Buffer>> buffers;
+    for (size_t i = 0; i < BufferPool::MAX_POOLED_BUFFERS + 2; ++i) {
+      buffers.push_back(BufferPool::acquire(MAX_NDN_PACKET_SIZE));
+    }
+    const Buffer* addr0 = buffers.front().get();
+
+    // buffers released by another thread return to the pool of the thread that acquired them
+    std::thread releaser([&buffers] { buffers.clear(); });
+    releaser.join();
+    BOOST_CHECK_EQUAL(BufferPool::acquire(MAX_NDN_PACKET_SIZE).get(), addr0);
+  });
+  thread.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBufferPool
+BOOST_AUTO_TEST_SUITE_END() // Detail
+
+} // namespace tests
+} // namespace detail
+} // namespace ndn
@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/block-view.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Encoding)
+BOOST_AUTO_TEST_SUITE(TestBlockView)
+
+BOOST_AUTO_TEST_CASE(Iterate)
+{
+  Block data = "0620 0711 080568656C6C6F 080131 0805776F726C64 "
+               "1400 1500 1605 1B0101 1C00 1700"_block;
+  ElementRange range(data);
+  BOOST_CHECK(!range.empty());
+
+  std::vector<uint32_t> types;
+  for (const auto& element : range) {
+    types.push_back(element.type());
+  }
+  std::vector<uint32_t> expectedTypes{tlv::Name, tlv::MetaInfo, tlv::Content,
+                                      tlv::SignatureInfo, tlv::SignatureValue};
+  BOOST_CHECK_EQUAL_COLLECTIONS(types.begin(), types.end(),
+                                expectedTypes.begin(), expectedTypes.end());
+
+  // iteration does not populate the sub-elements of the parent
+  BOOST_CHECK_EQUAL(data.elements_size(), 0);
+
+  auto it = range.begin();
+  BOOST_CHECK_EQUAL(it->size(), 19);
+  BOOST_CHECK_EQUAL(it->value_size(), 17);
+  BOOST_CHECK(it->wire() == data.value());
+  BOOST_CHECK(it->value() == data.value() + 2);
+
+  int nComponents = 0;
+  for (const auto& component : ElementRange(*it)) {
+    BOOST_CHECK_EQUAL(component.type(), tlv::GenericNameComponent);
+    ++nComponents;
+  }
+  BOOST_CHECK_EQUAL(nComponents, 3);
+
+  ++it;
+  BOOST_CHECK_EQUAL(it->value_size(), 0);
+  BOOST_CHECK(it->value() == nullptr);
+  BOOST_CHECK(ElementRange(*it).empty());
+  BOOST_CHECK(ElementRange(*it).begin() == ElementRange(*it).end());
+
+  data.parse();
+  BOOST_CHECK_EQUAL(std::distance(range.begin(), range.end()), data.elements_size());
+}
+
+BOOST_AUTO_TEST_CASE(ToBlock)
+{
+  Block name;
+  {
+    Block data = "0609 0705 0803414243 1500"_block;
+    name = ElementRange(data).begin()->toBlock();
+    BOOST_CHECK(name.getBuffer() == data.getBuffer());
+  }
+  // the Block keeps the underlying buffer alive after the parent is gone
+  BOOST_CHECK_EQUAL(name, "0705 0803414243"_block);
+  name.parse();
+  BOOST_CHECK_EQUAL(name.elements_size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  Block block(tlv::Content);
+  ElementRange range(block);
+  BOOST_CHECK(range.empty());
+  BOOST_CHECK(range.begin() == range.end());
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  // TLV-LENGTH of nested element is greater than TLV-LENGTH of enclosing element
+  Block bad("0505 0707080568"_block);
+  BOOST_CHECK_EXCEPTION(ElementRange(bad).begin(), Block::Error, [] (const auto& e) {
+    return e.what() == "TLV-LENGTH of sub-element of type 7 exceeds "
+                       "TLV-VALUE boundary of parent block"s;
+  });
+
+  // the second sub-element is truncated
+  Block truncated("0503 0100 01"_block);
+  ElementRange range(truncated);
+  auto it = range.begin();
+  BOOST_CHECK_EQUAL(it->type(), 1);
+  BOOST_CHECK_THROW(++it, tlv::Error);
+
+  // Block::parse() leaves the sub-elements empty on error
+  BOOST_CHECK_THROW(truncated.parse(), tlv::Error);
+  BOOST_CHECK_EQUAL(truncated.elements_size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBlockView
+BOOST_AUTO_TEST_SUITE_END() // Encoding
+
+} // namespace tests
+} // namespace ndn
@@ -619,6 +619,15 @@ BOOST_AUTO_TEST_CASE(Remove)
   BOOST_CHECK_EQUAL(readString(elements[1]).compare("/test-prefix"), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ReserveElements)
+{
+  Block block = makeStringBlock(tlv::Name, "/test-prefix");
+  block.reserveElements(10);
+  BOOST_CHECK_GE(block.elements().capacity(), 10);
+  BOOST_CHECK_EQUAL(block.elements_size(), 0);
+  BOOST_CHECK(block.hasWire()); // the encoding is not affected
+}
+
 BOOST_AUTO_TEST_SUITE_END() // SubElements
 
 BOOST_AUTO_TEST_CASE(ToAsioConstBuffer)
@@ -163,6 +163,27 @@ BOOST_AUTO_TEST_CASE(Reserve)
   BOOST_CHECK_GT(e.capacity(), 2000);
 }
 
+BOOST_AUTO_TEST_CASE(Clear)
+{
+  Encoder e(100, 10);
+  e.prependVarNumber(1);
+  e.appendVarNumber(2);
+  BOOST_CHECK_EQUAL(e.size(), 2);
+  auto buf = e.getBuffer();
+
+  e.clear(20);
+  BOOST_CHECK_EQUAL(e.size(), 0);
+  BOOST_CHECK_EQUAL(e.capacity(), 100);
+  BOOST_CHECK_EQUAL(e.getBuffer(), buf);
+  BOOST_CHECK_EQUAL(e.end() - buf->begin(), 80);
+
+  e.clear(200);
+  BOOST_CHECK_EQUAL(e.end() - buf->begin(), 100);
+  e.prependVarNumber(3);
+  BOOST_CHECK_EQUAL(e.size(), 1);
+  BOOST_CHECK_EQUAL(*e.begin(), 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestEncoder
 BOOST_AUTO_TEST_SUITE_END() // Encoding
 
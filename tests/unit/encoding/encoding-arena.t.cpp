@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/encoding-arena.hpp"
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/interest.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace ndn {
+namespace encoding {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Encoding)
+BOOST_AUTO_TEST_SUITE(TestEncodingArena)
+
+BOOST_AUTO_TEST_CASE(Reuse)
+{
+  shared_ptr<Buffer> arenaBuffer;
+  Block block1;
+  {
+    EncodingArena arena;
+    BOOST_CHECK_EQUAL(arena.encoder().size(), 0);
+    prependStringBlock(arena.encoder(), tlv::Content, "hello");
+    arenaBuffer = arena.encoder().getBuffer();
+    block1 = arena.block();
+  }
+  BOOST_CHECK_NE(block1.getBuffer(), arenaBuffer);
+  BOOST_CHECK_EQUAL(block1.getBuffer()->size(), 7);
+
+  // the next arena of the same thread starts empty, in the same buffer
+  EncodingArena arena;
+  BOOST_CHECK_EQUAL(arena.encoder().size(), 0);
+  BOOST_CHECK_EQUAL(arena.encoder().getBuffer(), arenaBuffer);
+  prependStringBlock(arena.encoder(), tlv::Content, "world");
+  Block block2 = arena.block();
+
+  // blocks copied out of the arena are not overwritten
+  BOOST_CHECK_EQUAL(readString(block1), "hello");
+  BOOST_CHECK_EQUAL(readString(block2), "world");
+}
+
+BOOST_AUTO_TEST_CASE(Nested)
+{
+  EncodingArena outer;
+  prependStringBlock(outer.encoder(), tlv::Content, "outer");
+  {
+    // the thread's buffer is in use, so the inner arena has its own
+    EncodingArena inner;
+    BOOST_CHECK_NE(inner.encoder().getBuffer(), outer.encoder().getBuffer());
+    prependStringBlock(inner.encoder(), tlv::Content, "inner");
+    BOOST_CHECK_EQUAL(readString(inner.block()), "inner");
+  }
+  BOOST_CHECK_EQUAL(readString(outer.block()), "outer");
+}
+
+BOOST_AUTO_TEST_CASE(Grow)
+{
+  const std::vector<uint8_t> large(EncodingArena::MAX_RETAINED_CAPACITY, 0xaa);
+  {
+    EncodingArena arena;
+    prependBinaryBlock(arena.encoder(), tlv::Content, large);
+    BOOST_CHECK_GT(arena.encoder().capacity(), EncodingArena::MAX_RETAINED_CAPACITY);
+    BOOST_CHECK_EQUAL(arena.block().value_size(), large.size());
+  }
+
+  // a buffer grown beyond MAX_RETAINED_CAPACITY is not kept
+  EncodingArena arena;
+  BOOST_CHECK_LE(arena.encoder().capacity(), EncodingArena::MAX_RETAINED_CAPACITY);
+}
+
+BOOST_AUTO_TEST_CASE(Exception)
+{
+  shared_ptr<Buffer> arenaBuffer;
+  {
+    EncodingArena arena;
+    arenaBuffer = arena.encoder().getBuffer();
+  }
+
+  // an Interest without a name cannot be encoded
+  BOOST_CHECK_THROW(Interest().wireEncode(), tlv::Error);
+
+  // the thread's buffer has been released
+  EncodingArena arena;
+  BOOST_CHECK_EQUAL(arena.encoder().getBuffer(), arenaBuffer);
+  BOOST_CHECK_EQUAL(arena.encoder().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(OtherThread)
+{
+  shared_ptr<Buffer> arenaBuffer;
+  {
+    EncodingArena arena;
+    arenaBuffer = arena.encoder().getBuffer();
+  }
+
+  // each thread has its own buffer
+  std::thread thread([&arenaBuffer] {
+    EncodingArena arena;
+    BOOST_CHECK_NE(arena.encoder().getBuffer(), arenaBuffer);
+  });
+  thread.join();
+}
+
+BOOST_AUTO_TEST_CASE(PacketEncoding)
+{
+  // wireEncode() encodes in a single pass, into a buffer of the exact size
+  auto data = makeData("/arena/data");
+  data->setContent(std::vector<uint8_t>(3000, 0xbb));
+  const Block& dataWire = data->wireEncode();
+  BOOST_CHECK_EQUAL(dataWire.getBuffer()->size(), dataWire.size());
+  BOOST_CHECK_EQUAL(Data(dataWire).getContent().value_size(), 3000);
+
+  Interest interest("/arena/interest");
+  interest.setNonce(0x2a);
+  const Block& interestWire = interest.wireEncode();
+  BOOST_CHECK_EQUAL(interestWire.getBuffer()->size(), interestWire.size());
+  BOOST_CHECK_EQUAL(Interest(interestWire).getName(), "/arena/interest");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestEncodingArena
+BOOST_AUTO_TEST_SUITE_END() // Encoding
+
+} // namespace tests
+} // namespace encoding
+} // namespace ndn
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/interest-filter-record.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/io-fixture.hpp"
+
+namespace ndn {
+namespace tests {
+
+using detail::RecordId;
+
+class InterestFilterFixture : public IoFixture
+{
+protected:
+  RecordId
+  insert(const InterestFilter& filter)
+  {
+    return m_filters.insert(filter, nullptr, m_filterIndex).getId();
+  }
+
+  /** @brief Returns the IDs of the filters that match an Interest from the forwarder
+   */
+  std::vector<RecordId>
+  dispatch(const Name& interestName)
+  {
+    PendingInterest entry(makeInterest(interestName), m_scheduler, m_interestIndex);
+    std::vector<RecordId> matched;
+    m_filters.forEach(m_filterIndex.findCandidates(interestName),
+                      [&] (const InterestFilterRecord& record) {
+      if (record.doesMatch(entry)) {
+        matched.push_back(record.getId());
+      }
+    });
+    return matched;
+  }
+
+protected:
+  Scheduler m_scheduler{m_io};
+  PendingInterestIndex m_interestIndex;
+  InterestFilterIndex m_filterIndex; // must outlive m_filters
+  detail::RecordContainer<InterestFilterRecord> m_filters;
+};
+
+using Ids = std::vector<RecordId>;
+
+BOOST_AUTO_TEST_SUITE(Impl)
+BOOST_FIXTURE_TEST_SUITE(TestInterestFilterIndex, InterestFilterFixture)
+
+BOOST_AUTO_TEST_CASE(SamePrefix)
+{
+  RecordId id1 = insert("/A");
+  RecordId id2 = insert("/A/B");
+  RecordId id3 = insert("/A");
+  insert("/A/B/C");
+  insert("/B");
+  BOOST_CHECK_EQUAL(m_filterIndex.size(), 5);
+
+  // every filter on a prefix of the name is a candidate, in insertion order
+  Ids candidates = m_filterIndex.findCandidates("/A/B");
+  BOOST_TEST(candidates == (Ids{id1, id2, id3}), boost::test_tools::per_element());
+  Ids matched = dispatch("/A/B");
+  BOOST_TEST(matched == (Ids{id1, id2, id3}), boost::test_tools::per_element());
+
+  m_filters.erase(id1);
+  matched = dispatch("/A/B");
+  BOOST_TEST(matched == (Ids{id2, id3}), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(m_filterIndex.size(), 4);
+
+  BOOST_CHECK(m_filterIndex.findCandidates("/C").empty());
+}
+
+BOOST_AUTO_TEST_CASE(Regex)
+{
+  RecordId idRegex = insert(InterestFilter("/A", "<B><>*"));
+  RecordId idPlain = insert("/A/B");
+
+  // a regex filter is a candidate under its prefix, whether or not its regex matches
+  Ids candidates = m_filterIndex.findCandidates("/A/C");
+  BOOST_TEST(candidates == (Ids{idRegex}), boost::test_tools::per_element());
+  BOOST_CHECK(dispatch("/A/C").empty());
+
+  Ids matched = dispatch("/A/B/C");
+  BOOST_TEST(matched == (Ids{idRegex, idPlain}), boost::test_tools::per_element());
+  BOOST_CHECK(dispatch("/B").empty());
+}
+
+BOOST_AUTO_TEST_CASE(UnsetDuringDispatch)
+{
+  RecordId id1 = insert("/A");
+  RecordId id2 = insert("/A");
+  RecordId id3 = insert("/A/B");
+  RecordId id4 = insert("/A/B");
+
+  // a callback may unset its own filter or a filter yet to be visited
+  Ids visited;
+  m_filters.forEach(m_filterIndex.findCandidates("/A/B"), [&] (const InterestFilterRecord& record) {
+    RecordId id = record.getId();
+    visited.push_back(id);
+    if (id == id2) {
+      m_filters.erase(id2);
+      m_filters.erase(id3);
+    }
+  });
+  BOOST_TEST(visited == (Ids{id1, id2, id4}), boost::test_tools::per_element());
+
+  BOOST_CHECK(m_filters.get(id2) == nullptr);
+  BOOST_CHECK(m_filters.get(id3) == nullptr);
+  BOOST_CHECK_EQUAL(m_filterIndex.size(), 2);
+  Ids matched = dispatch("/A/B");
+  BOOST_TEST(matched == (Ids{id1, id4}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestFilterIndex
+BOOST_AUTO_TEST_SUITE_END() // Impl
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/parallel-for.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+using detail::parallelFor;
+
+BOOST_AUTO_TEST_SUITE(Impl)
+BOOST_AUTO_TEST_SUITE(TestParallelFor)
+
+BOOST_AUTO_TEST_CASE(Ranges)
+{
+  for (size_t nThreads : {0, 1, 3, 8}) {
+    BOOST_TEST_CONTEXT("nThreads=" << nThreads) {
+      std::vector<int> visits(100);
+      std::atomic<size_t> nRanges{0};
+      parallelFor(visits.size(), nThreads, [&] (size_t begin, size_t end) {
+        ++nRanges;
+        for (size_t i = begin; i < end; ++i) {
+          ++visits[i];
+        }
+      });
+      BOOST_CHECK_EQUAL(nRanges, std::max<size_t>(nThreads, 1));
+      BOOST_CHECK(std::all_of(visits.begin(), visits.end(), [] (int n) { return n == 1; }));
+    }
+  }
+
+  bool isCalled = false;
+  parallelFor(0, 4, [&] (size_t, size_t) { isCalled = true; });
+  BOOST_CHECK_EQUAL(isCalled, false);
+}
+
+BOOST_AUTO_TEST_CASE(ReuseThreads)
+{
+  const auto caller = std::this_thread::get_id();
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t maxRangesPerHelper = 0;
+
+  for (int i = 0; i < 20; ++i) {
+    size_t nStarted = 0;
+    parallelFor(4, 4, [&] (size_t, size_t) {
+      thread_local size_t nRanges = 0;
+      ++nRanges;
+
+      // wait until all ranges have started, so that each of them runs on a different thread
+      std::unique_lock<std::mutex> lock(mutex);
+      if (++nStarted == 4) {
+        cv.notify_all();
+      }
+      cv.wait(lock, [&] { return nStarted == 4; });
+      if (std::this_thread::get_id() != caller) {
+        maxRangesPerHelper = std::max(maxRangesPerHelper, nRanges);
+      }
+    });
+  }
+  // helper threads are not created per call
+  BOOST_CHECK_GT(maxRangesPerHelper, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Nested)
+{
+  std::atomic<size_t> nVisits{0};
+  parallelFor(4, 4, [&] (size_t, size_t) {
+    parallelFor(4, 4, [&] (size_t begin, size_t end) { nVisits += end - begin; });
+  });
+  BOOST_CHECK_EQUAL(nVisits, 16);
+}
+
+BOOST_AUTO_TEST_CASE(Exception)
+{
+  std::atomic<size_t> nRanges{0};
+  BOOST_CHECK_THROW(parallelFor(10, 5, [&] (size_t begin, size_t) {
+                      ++nRanges;
+                      if (begin >= 4) {
+                        NDN_THROW(std::runtime_error(to_string(begin)));
+                      }
+                    }), std::runtime_error);
+  // the other ranges are processed nonetheless
+  BOOST_CHECK_EQUAL(nRanges, 5);
+
+  try {
+    parallelFor(10, 5, [] (size_t begin, size_t) {
+      if (begin >= 4) {
+        NDN_THROW(std::runtime_error(to_string(begin)));
+      }
+    });
+  }
+  catch (const std::runtime_error& e) {
+    // the exception of the first failing range is rethrown
+    BOOST_CHECK_EQUAL(e.what(), std::string("4"));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestParallelFor
+BOOST_AUTO_TEST_SUITE_END() // Impl
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/pending-interest.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/io-fixture.hpp"
+
+namespace ndn {
+namespace tests {
+
+using detail::RecordId;
+
+class PendingInterestFixture : public IoFixture
+{
+protected:
+  RecordId
+  insert(const Name& name, bool canBePrefix = false)
+  {
+    return m_table.insert(makeInterest(name, canBePrefix), nullptr, nullptr, nullptr,
+                          m_scheduler, m_index).getId();
+  }
+
+protected:
+  Scheduler m_scheduler{m_io};
+  PendingInterestIndex m_index; // must outlive m_table
+  detail::RecordContainer<PendingInterest> m_table;
+};
+
+BOOST_AUTO_TEST_SUITE(Impl)
+BOOST_FIXTURE_TEST_SUITE(TestPendingInterestIndex, PendingInterestFixture)
+
+BOOST_AUTO_TEST_CASE(FindData)
+{
+  auto data = makeData("/A/B");
+
+  RecordId idA = insert("/A", true);
+  RecordId idAB = insert("/A/B");
+  insert("/A/B/C", true);
+  RecordId idC = insert("/C", true);
+  RecordId idFull = insert(data->getFullName());
+  insert(makeData("/A/B/D")->getFullName());
+  BOOST_CHECK_EQUAL(m_index.size(), 6);
+
+  // candidates are the Interests named by a prefix of the Data name, in insertion order,
+  // including full names; they are not checked against CanBePrefix or the implicit digest
+  using Ids = PendingInterestIndex::Candidates;
+  Ids candidates = m_index.findDataCandidates(*data);
+  BOOST_TEST(candidates == (Ids{idA, idAB, idFull}), boost::test_tools::per_element());
+
+  candidates = m_index.findDataCandidates(*makeData("/C/D"));
+  BOOST_TEST(candidates == (Ids{idC}), boost::test_tools::per_element());
+
+  BOOST_CHECK(m_index.findDataCandidates(*makeData("/D")).empty());
+  BOOST_CHECK(m_index.findDataCandidates(*makeData("/")).empty());
+}
+
+BOOST_AUTO_TEST_CASE(FindNack)
+{
+  RecordId id1 = insert("/A");
+  insert("/A/B");
+  RecordId id3 = insert("/A");
+
+  using Ids = PendingInterestIndex::Candidates;
+  lp::Nack nack(*makeInterest("/A"));
+  Ids candidates = m_index.findNackCandidates(nack);
+  BOOST_TEST(candidates == (Ids{id1, id3}), boost::test_tools::per_element());
+
+  lp::Nack nack2(*makeInterest("/A/B/C"));
+  BOOST_CHECK(m_index.findNackCandidates(nack2).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  auto data = makeData("/A/B");
+  RecordId id1 = insert("/A", true);
+  RecordId id2 = insert("/A", true);
+
+  // a record leaves the index when it is erased, by the container or on timeout
+  m_table.erase(id1);
+  BOOST_CHECK_EQUAL(m_index.size(), 1);
+  auto candidates = m_index.findDataCandidates(*data);
+  BOOST_REQUIRE_EQUAL(candidates.size(), 1);
+  BOOST_CHECK_EQUAL(candidates[0], id2);
+
+  advanceClocks(1_s, 5); // default InterestLifetime is 4s
+  BOOST_CHECK(m_table.empty());
+  BOOST_CHECK_EQUAL(m_index.size(), 0);
+  BOOST_CHECK(m_index.findDataCandidates(*data).empty());
+
+  insert("/A", true);
+  m_table.clear();
+  BOOST_CHECK_EQUAL(m_index.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RemoveWhileVisiting)
+{
+  auto data = makeData("/A/B");
+  RecordId id1 = insert("/A", true);
+  RecordId id2 = insert("/A/B");
+  RecordId id3 = insert("/A/B");
+  auto candidates = m_index.findDataCandidates(*data);
+  BOOST_CHECK_EQUAL(candidates.size(), 3);
+
+  // IDs of records erased after the lookup are skipped, including by the visitor itself
+  m_table.erase(id1);
+  std::vector<RecordId> visited;
+  m_table.removeIf(candidates, [&] (PendingInterest& entry) {
+    visited.push_back(entry.getId());
+    if (entry.getId() == id2) {
+      m_table.erase(id3);
+    }
+    return true;
+  });
+  BOOST_TEST(visited == (std::vector<RecordId>{id2}), boost::test_tools::per_element());
+  BOOST_CHECK(m_table.empty());
+  BOOST_CHECK_EQUAL(m_index.size(), 0);
+
+  // the record of an erased ID is gone, and a new record gets a new ID
+  BOOST_CHECK(m_table.get(id2) == nullptr);
+  RecordId id4 = insert("/A/B");
+  BOOST_CHECK_GT(id4, id3);
+  BOOST_CHECK(m_table.get(id4) != nullptr);
+  candidates = m_index.findDataCandidates(*data);
+  BOOST_REQUIRE_EQUAL(candidates.size(), 1);
+  BOOST_CHECK_EQUAL(candidates[0], id4);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPendingInterestIndex
+BOOST_AUTO_TEST_SUITE_END() // Impl
+
+} // namespace tests
+} // namespace ndn
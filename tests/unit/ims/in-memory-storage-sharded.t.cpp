@@ -0,0 +1,209 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/clock-fixture.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include <boost/asio/io_service.hpp>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Ims)
+
+class ShardedFixture : public ClockFixture
+{
+protected:
+  void
+  insertFresh(const Name& name, time::milliseconds window = InMemoryStorage::INFINITE_WINDOW)
+  {
+    auto data = make_shared<Data>(name);
+    data->setFreshnessPeriod(1_h);
+    signData(data);
+    m_ims.insert(*data, window);
+  }
+
+protected:
+  InMemoryStorageSharded m_ims{4, [] { return make_unique<InMemoryStoragePersistent>(); }};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestInMemoryStorageSharded, ShardedFixture)
+
+BOOST_AUTO_TEST_CASE(InsertFind)
+{
+  for (int i = 0; i < 100; ++i) {
+    m_ims.insert(*makeData(Name("/A").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(m_ims.getNShards(), 4);
+  BOOST_CHECK_EQUAL(m_ims.size(), 100);
+  BOOST_CHECK_EQUAL(m_ims.getCounters().nEntries, 100);
+  BOOST_CHECK_GT(m_ims.getCounters().nBytes, 0);
+
+  auto data = makeData("/A/B");
+  m_ims.insert(*data);
+
+  BOOST_CHECK_EQUAL(*m_ims.find(*makeInterest("/A/B")), *data);
+  BOOST_CHECK_EQUAL(*m_ims.find(*makeInterest(data->getFullName())), *data);
+  BOOST_CHECK(m_ims.find(*makeInterest("/A")) == nullptr);
+  BOOST_CHECK(m_ims.find(*makeInterest("/A/B/C", true)) == nullptr);
+  BOOST_CHECK_EQUAL(m_ims.find(*makeInterest(Name("/A").appendNumber(7), true))->getName(),
+                    Name("/A").appendNumber(7));
+  BOOST_CHECK(m_ims.find(*makeInterest("/A", true)) != nullptr);
+
+  BOOST_CHECK_EQUAL(*m_ims.find(Name("/A/B")), *data);
+  BOOST_CHECK_EQUAL(*m_ims.find(data->getFullName()), *data);
+  BOOST_CHECK(m_ims.find(Name("/Z")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  auto data = makeData("/A/B");
+  m_ims.insert(*data);
+  for (int i = 0; i < 20; ++i) {
+    m_ims.insert(*makeData(Name("/A/C").appendNumber(i)));
+    m_ims.insert(*makeData(Name("/D").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(m_ims.size(), 41);
+
+  m_ims.erase("/A/B", false);
+  BOOST_CHECK_EQUAL(m_ims.size(), 41);
+  m_ims.erase(data->getFullName(), false);
+  BOOST_CHECK_EQUAL(m_ims.size(), 40);
+
+  m_ims.erase("/A");
+  BOOST_CHECK_EQUAL(m_ims.size(), 20);
+  BOOST_CHECK(m_ims.find(*makeInterest("/A", true)) == nullptr);
+  BOOST_CHECK(m_ims.find(*makeInterest("/D", true)) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(MustBeFresh)
+{
+  insertFresh("/A/1", 200_ms);
+  insertFresh("/A/2");
+
+  auto interest = makeInterest("/A/1", false);
+  interest->setMustBeFresh(true);
+  BOOST_CHECK(m_ims.find(*interest) != nullptr);
+
+  advanceClocks(100_ms, 3);
+  BOOST_CHECK(m_ims.find(*interest) == nullptr);
+  interest->setMustBeFresh(false);
+  BOOST_CHECK(m_ims.find(*interest) != nullptr);
+
+  interest = makeInterest("/A", true);
+  interest->setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(m_ims.find(*interest)->getName(), "/A/2");
+}
+
+BOOST_AUTO_TEST_CASE(LimitPerShard)
+{
+  InMemoryStorageSharded ims(2, [] { return make_unique<InMemoryStorageLru>(10); });
+  for (int i = 0; i < 100; ++i) {
+    ims.insert(*makeData(Name("/A").appendNumber(i)));
+  }
+  BOOST_CHECK_LE(ims.size(), 20);
+  BOOST_CHECK_EQUAL(ims.getCounters().nEvictions, 100 - ims.size());
+}
+
+BOOST_AUTO_TEST_CASE(ShardWithIoService)
+{
+  boost::asio::io_service io;
+  BOOST_CHECK_THROW(InMemoryStorageSharded(2, [&io] { return make_unique<InMemoryStorageLru>(io, 10); }),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Concurrent)
+{
+  const int nThreads = 4;
+  const int nPerThread = 200;
+
+  // packets and Interests are prepared in advance, so that the threads share them read-only
+  std::vector<std::vector<shared_ptr<Data>>> data(nThreads);
+  std::vector<std::vector<Interest>> interests(nThreads);
+  for (int t = 0; t < nThreads; ++t) {
+    for (int i = 0; i < nPerThread; ++i) {
+      data[t].push_back(makeData(Name("/T").appendNumber(t).appendNumber(i)));
+      interests[t].emplace_back(data[t].back()->getName());
+    }
+  }
+
+  auto findAll = [&] (int t, std::atomic<int>& nFound, std::atomic<int>& nMismatched) {
+    for (size_t i = 0; i < interests[t].size(); ++i) {
+      auto found = m_ims.find(interests[t][i]);
+      if (found != nullptr) {
+        ++nFound;
+        if (found != data[t][i]) {
+          ++nMismatched;
+        }
+      }
+    }
+  };
+
+  // look up the packets inserted by another thread, while it may still be inserting them
+  std::atomic<int> nFound{0};
+  std::atomic<int> nMismatched{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (const auto& d : data[t]) {
+        m_ims.insert(*d);
+      }
+      findAll((t + 1) % nThreads, nFound, nMismatched);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // a packet found while being inserted is the packet that was inserted
+  BOOST_CHECK_EQUAL(nMismatched, 0);
+  BOOST_CHECK_EQUAL(m_ims.size(), nThreads * nPerThread);
+
+  // once all insertions have completed, every thread finds every packet of another thread
+  nFound = 0;
+  threads.clear();
+  for (int t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t] { findAll((t + 1) % nThreads, nFound, nMismatched); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK_EQUAL(nFound, nThreads * nPerThread);
+  BOOST_CHECK_EQUAL(nMismatched, 0);
+
+  for (const auto& perThread : data) {
+    for (const auto& d : perThread) {
+      BOOST_CHECK_EQUAL(m_ims.find(d->getFullName()), d);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageSharded
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace tests
+} // namespace ndn
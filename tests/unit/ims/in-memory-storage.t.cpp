@@ -201,6 +201,52 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndNotFindByFullName, T, InMemoryStorages)
   BOOST_CHECK(found == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(FindByFullNameSameName, T, InMemoryStorages)
+{
+  T ims;
+
+  Name name("/a");
+  const uint8_t content1[] = {1, 2, 3, 4};
+  auto data1 = makeData(name);
+  data1->setContent(content1);
+  signData(data1);
+  ims.insert(*data1);
+
+  const uint8_t content2[] = {5, 6, 7, 8};
+  auto data2 = makeData(name);
+  data2->setContent(content2);
+  signData(data2);
+  ims.insert(*data2);
+
+  auto data3 = makeData(Name(name).append("b"));
+  ims.insert(*data3);
+  BOOST_CHECK_EQUAL(ims.size(), 3);
+
+  // inserting the same packet again is a no-op
+  ims.insert(*data2);
+  BOOST_CHECK_EQUAL(ims.size(), 3);
+
+  auto found = ims.find(data1->getFullName());
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), data1->wireEncode());
+
+  found = ims.find(data2->getFullName());
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), data2->wireEncode());
+
+  found = ims.find(data3->getFullName());
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), data3->wireEncode());
+
+  // a longer name starting with the full name of a stored Data does not match it
+  BOOST_CHECK(ims.find(Name(data1->getFullName()).append("c")) == nullptr);
+
+  ims.erase(data2->getFullName(), false);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(data2->getFullName()) == nullptr);
+  BOOST_CHECK(ims.find(data1->getFullName()) != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndEraseByName, T, InMemoryStorages)
 {
   T ims;
@@ -439,6 +485,64 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndEvict, T, InMemoryStoragesLimited)
   shared_ptr<Interest> interest = makeInterest(name);
   shared_ptr<const Data> found = ims.find(*interest);
   BOOST_CHECK(found == nullptr);
+  BOOST_CHECK_EQUAL(ims.getCounters().nEvictions, 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ByteLimit, T, InMemoryStoragesLimited)
+{
+  T ims;
+
+  std::vector<shared_ptr<Data>> packets;
+  for (int i = 0; i < 5; ++i) {
+    packets.push_back(makeData("/insert/" + to_string(i)));
+  }
+  size_t entrySize = InMemoryStorageEntry::computeMemoryUsage(*packets[0]);
+  BOOST_CHECK_GT(entrySize, packets[0]->wireEncode().size() + sizeof(InMemoryStorageEntry));
+
+  ims.setByteLimit(3 * entrySize);
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), 3 * entrySize);
+  for (const auto& data : packets) {
+    ims.insert(*data);
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 3);
+  BOOST_CHECK_EQUAL(ims.getCounters().nEntries, 3);
+  BOOST_CHECK_EQUAL(ims.getCounters().nBytes, 3 * entrySize);
+  BOOST_CHECK_EQUAL(ims.getCounters().nEvictions, 2);
+  BOOST_CHECK(ims.find(packets[4]->getName()) != nullptr);
+
+  // a packet larger than the byte limit is not inserted
+  auto large = makeData("/insert/large");
+  large->setContent(std::vector<uint8_t>(3 * entrySize));
+  signData(large);
+  ims.insert(*large);
+  BOOST_CHECK_EQUAL(ims.size(), 3);
+  BOOST_CHECK(ims.find(large->getName()) == nullptr);
+
+  ims.setByteLimit(entrySize);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK_EQUAL(ims.getCounters().nBytes, entrySize);
+  BOOST_CHECK_EQUAL(ims.getCounters().nEvictions, 4);
+
+  ims.erase("/insert");
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+  BOOST_CHECK_EQUAL(ims.getCounters().nBytes, 0);
+  BOOST_CHECK_EQUAL(ims.getCounters().nEvictions, 4);
+}
+
+BOOST_AUTO_TEST_CASE(ByteLimitPersistent)
+{
+  InMemoryStoragePersistent ims;
+
+  auto data1 = makeData("/insert/1");
+  auto data2 = makeData("/insert/2");
+  ims.setByteLimit(InMemoryStorageEntry::computeMemoryUsage(*data1));
+
+  ims.insert(*data1);
+  ims.insert(*data2);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK_EQUAL(ims.getCounters().nEvictions, 0);
+
+  BOOST_CHECK_THROW(ims.setByteLimit(0), InMemoryStorage::Error);
 }
 
 // Find function is implemented at the base case, so it's sufficient to test for one derived class.
@@ -598,6 +702,112 @@ BOOST_AUTO_TEST_CASE(MustBeFresh)
   BOOST_CHECK_EQUAL(find(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ExactName_MustBeFresh)
+{
+  insert(1, "/A", [] (Data& data) { data.setFreshnessPeriod(1_s); }, 1_s);
+  insert(2, "/A/B", [] (Data& data) { data.setFreshnessPeriod(1_s); }, 1_s);
+
+  advanceClocks(500_ms); // @500ms
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 1);
+
+  insert(3, "/A", [] (Data& data) { data.setFreshnessPeriod(1_h); }, 1_h);
+
+  advanceClocks(1500_ms); // @2s
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 3);
+
+  startInterest("/A/B")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+
+  startInterest("/A/B");
+  BOOST_CHECK_EQUAL(find(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(MustBeFresh_Batched)
+{
+  for (uint32_t i = 1; i <= 100; ++i) {
+    insert(i, Name("/A").appendNumber(i), [] (Data& data) { data.setFreshnessPeriod(1_h); }, 1_s);
+  }
+  insert(101, "/B", [] (Data& data) { data.setFreshnessPeriod(1_h); }, 3_s);
+
+  // erased entries are returned to the pool and reused, and must not be marked as non-fresh
+  m_ims.erase("/A");
+  insert(102, "/A/102", [] (Data& data) { data.setFreshnessPeriod(1_h); }, 2_s);
+  insert(103, "/A/103", [] (Data& data) { data.setFreshnessPeriod(1_h); }, 2_s);
+
+  advanceClocks(1500_ms); // @1.5s
+  startInterest("/A")
+    .setCanBePrefix(true)
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 102);
+
+  advanceClocks(1_s); // @2.5s
+  startInterest("/A")
+    .setCanBePrefix(true)
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+  startInterest("/B")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 101);
+
+  advanceClocks(1_s); // @3.5s
+  startInterest("/B")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+  startInterest("/B");
+  BOOST_CHECK_EQUAL(find(), 101);
+}
+
+BOOST_AUTO_TEST_CASE(MustBeFresh_NotEarly)
+{
+  advanceClocks(3_ms); // @3ms
+  insert(1, "/A", [] (Data& data) { data.setFreshnessPeriod(1_h); }, 15_ms); // stale @20ms
+  insert(2, "/B", [] (Data& data) { data.setFreshnessPeriod(1_h); }, 26_ms); // stale @30ms
+
+  // the timer of /A fires late, in the middle of the tick of /B
+  advanceClocks(21_ms); // @24ms
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+  startInterest("/B")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 2);
+
+  advanceClocks(6_ms); // @30ms
+  startInterest("/B")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(AfterErase)
+{
+  Name n1 = insert(1, "/A/B/C");
+  insert(2, "/A/D");
+
+  m_ims.erase("/A/B");
+  startInterest("/A/B")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+  startInterest("/A")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), 2);
+
+  m_ims.erase("/A");
+  BOOST_CHECK_EQUAL(find(), 0);
+  BOOST_CHECK(m_ims.find(Name("/A")) == nullptr);
+
+  insert(1, "/A/B/C");
+  startInterest("/A/B")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), 1);
+  startInterest(n1);
+  BOOST_CHECK_EQUAL(find(), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Find
 BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorage
 BOOST_AUTO_TEST_SUITE_END() // Ims
@@ -320,6 +320,48 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(FourOctets, T, ContainerTypes)
 
 BOOST_AUTO_TEST_SUITE_END() // CreateFromIterators
 
+BOOST_AUTO_TEST_CASE(CreateConsecutive)
+{
+  // small components are encoded back-to-back into a shared buffer,
+  // but each of them must still look like a standalone TLV element
+  Component c1("A");
+  Component c2 = Component::fromNumber(0x1234, 0xFCEC);
+  Component c3 = Component::fromNumberWithMarker(0xFB, 1);
+  Component c4(std::string(300, 'x'));
+
+  BOOST_CHECK_EQUAL(c1.wireEncode(), "080141"_block);
+  BOOST_CHECK_EQUAL(c2.wireEncode(), "FDFCEC021234"_block);
+  BOOST_CHECK_EQUAL(c3.wireEncode(), "0802FB01"_block);
+  BOOST_CHECK_EQUAL(c4.value_size(), 300);
+  BOOST_CHECK_EQUAL(c4.size(), 304);
+
+  // octets of a component are not affected by components created later
+  std::vector<Component> components;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    components.push_back(Component::fromSegment(i));
+  }
+  for (uint64_t i = 0; i < 1000; ++i) {
+    BOOST_CHECK_EQUAL(components[i].toSegment(), i);
+    BOOST_CHECK_EQUAL(components[i], Component::fromSegment(i));
+  }
+  BOOST_CHECK_EQUAL(c1.wireEncode(), "080141"_block);
+
+  // a small component does not keep much memory alive
+  BOOST_CHECK_LE(c1.wireEncode().getBuffer()->size(), 256);
+  BOOST_CHECK_EQUAL(c4.wireEncode().getBuffer()->size(), 304);
+
+  // once its components are gone, a chunk is reused in place
+  components.clear();
+  const Buffer* chunk = Component::fromSegment(0).wireEncode().getBuffer().get();
+  size_t nOtherChunks = 0;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    if (Component::fromSegment(i).wireEncode().getBuffer().get() != chunk) {
+      ++nOtherChunks;
+    }
+  }
+  BOOST_CHECK_EQUAL(nOtherChunks, 0);
+}
+
 BOOST_AUTO_TEST_SUITE(NamingConvention)
 
 template<typename ArgType>
@@ -23,6 +23,7 @@
 
 #include "tests/boost-test.hpp"
 
+#include <thread>
 #include <unordered_map>
 
 namespace ndn {
@@ -528,6 +529,84 @@ BOOST_AUTO_TEST_CASE(UnorderedMap)
   BOOST_CHECK_EQUAL(map[name3], 3);
 }
 
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  Name name("/A/B/C");
+  Name decoded(name.wireEncode());
+  BOOST_CHECK_EQUAL(name.getHash(), decoded.getHash());
+  BOOST_CHECK_EQUAL(std::hash<Name>()(name), name.getHash());
+  BOOST_CHECK_NE(name.getHash(), Name("/A/B/D").getHash());
+
+  const auto& prefixHashes = name.getPrefixHashes();
+  BOOST_REQUIRE_EQUAL(prefixHashes.size(), 4);
+  for (size_t i = 0; i <= name.size(); ++i) {
+    BOOST_CHECK_EQUAL(prefixHashes[i], name.getPrefix(static_cast<ssize_t>(i)).getHash());
+  }
+  BOOST_CHECK_EQUAL(prefixHashes.back(), name.getHash());
+  BOOST_CHECK_EQUAL(prefixHashes.front(), Name().getHash());
+
+  // cached hashes are invalidated when the name is modified
+  size_t oldHash = name.getHash();
+  name.appendSegment(1);
+  BOOST_CHECK_NE(name.getHash(), oldHash);
+  BOOST_CHECK_EQUAL(name.getPrefixHashes().size(), 5);
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A/B/C").appendSegment(1).getHash());
+  name.set(-1, Name::Component("D"));
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A/B/C/D").getHash());
+  name.erase(-1);
+  BOOST_CHECK_EQUAL(name.getHash(), oldHash);
+  name.wireDecode(Name("/X").wireEncode());
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/X").getHash());
+  name.clear();
+  BOOST_CHECK_EQUAL(name.getHash(), Name().getHash());
+}
+
+BOOST_AUTO_TEST_CASE(HashCopy)
+{
+  Name name("/A/B/C");
+  size_t hash = name.getHash();
+
+  // copies share the cached hashes until either of them is modified
+  Name copy(name);
+  Name assigned;
+  assigned = name;
+  BOOST_CHECK_EQUAL(&copy.getPrefixHashes(), &name.getPrefixHashes());
+  BOOST_CHECK_EQUAL(&assigned.getPrefixHashes(), &name.getPrefixHashes());
+  BOOST_CHECK_EQUAL(copy, name);
+
+  copy.append("D");
+  BOOST_CHECK_NE(&copy.getPrefixHashes(), &name.getPrefixHashes());
+  BOOST_CHECK_NE(copy.getHash(), hash);
+  BOOST_CHECK_EQUAL(name.getHash(), hash);
+
+  Name moved(std::move(assigned));
+  BOOST_CHECK_EQUAL(moved.getHash(), hash);
+  name = Name();
+  BOOST_CHECK_EQUAL(moved.getHash(), hash);
+  BOOST_CHECK_EQUAL(name.getHash(), Name().getHash());
+}
+
+BOOST_AUTO_TEST_CASE(HashConcurrent)
+{
+  // the hashes of a const Name can be computed by several threads at once
+  const Name name("/hash/concurrently/from/several/threads");
+  const size_t expected = Name(name.wireEncode()).getHash();
+
+  std::vector<std::thread> threads;
+  std::vector<size_t> hashes(4);
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    threads.emplace_back([&name, &hashes, i] {
+      hashes[i] = name.getPrefixHashes().back() ^ name.getHash() ^ name.getHash();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (size_t hash : hashes) {
+    BOOST_CHECK_EQUAL(hash, expected);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestName
 
 } // namespace tests
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/evp-crypto.hpp"
+
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/key-params.hpp"
+#include "ndn-cxx/security/transform/bool-sink.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/digest-filter.hpp"
+#include "ndn-cxx/security/transform/private-key.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/transform/signer-filter.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/security/transform/verifier-filter.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace ndn {
+namespace security {
+namespace detail {
+namespace tests {
+
+using namespace ndn::security::transform;
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_AUTO_TEST_SUITE(TestEvpCrypto)
+
+const uint8_t DATA1[] = {0x01, 0x02, 0x03, 0x04};
+const uint8_t DATA2[] = {0x05, 0x06, 0x07, 0x08, 0x09};
+const uint8_t DATA[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09};
+
+BOOST_AUTO_TEST_CASE(Digest)
+{
+  for (auto algo : {DigestAlgorithm::SHA256, DigestAlgorithm::SHA512, DigestAlgorithm::SM3}) {
+    BOOST_TEST_CONTEXT(algo) {
+      OBufferStream os;
+      bufferSource(DATA) >> digestFilter(algo) >> streamSink(os);
+      auto expected = os.buf();
+
+      std::array<uint8_t, EvpCrypto::MAX_DIGEST_SIZE> digest{};
+      auto out = make_span(digest);
+      size_t digestSize = EvpCrypto::digest(algo, InputBuffers{DATA1, DATA2}, out);
+      BOOST_TEST(out.first(digestSize) == *expected, boost::test_tools::per_element());
+
+      digest = {};
+      digestSize = EvpCrypto::digest(algo, DATA, out);
+      BOOST_TEST(out.first(digestSize) == *expected, boost::test_tools::per_element());
+
+      BOOST_CHECK_EQUAL(EvpCrypto::digest(algo, DATA, out.first(expected->size() - 1)), 0);
+    }
+  }
+
+  std::array<uint8_t, EvpCrypto::MAX_DIGEST_SIZE> digest{};
+  BOOST_CHECK_EQUAL(EvpCrypto::digest(DigestAlgorithm::NONE, DATA, digest), 0);
+}
+
+struct RsaKey
+{
+  RsaKeyParams params;
+  KeyType type = KeyType::RSA;
+};
+
+struct EcKey
+{
+  EcKeyParams params;
+  KeyType type = KeyType::EC;
+};
+
+struct Sm2Key
+{
+  sm2KeyParams params;
+  KeyType type = KeyType::SM2;
+};
+
+using KeyTypes = boost::mpl::vector<RsaKey, EcKey, Sm2Key>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SignVerify, T, KeyTypes)
+{
+  T keyInfo;
+  auto digestAlgo = keyInfo.type == KeyType::SM2 ? DigestAlgorithm::SM3 : DigestAlgorithm::SHA256;
+  auto sKey = generatePrivateKey(keyInfo.params);
+  PublicKey pKey;
+  pKey.loadPkcs8(*sKey->derivePublicKey());
+
+  size_t maxSigSize = EvpCrypto::getMaxSignatureSize(*sKey);
+  BOOST_REQUIRE_GT(maxSigSize, 0);
+  Buffer sig(maxSigSize);
+  size_t sigSize = EvpCrypto::sign(digestAlgo, *sKey, keyInfo.type, {DATA1, DATA2}, sig);
+  BOOST_REQUIRE_GT(sigSize, 0);
+  sig.resize(sigSize);
+
+  // signatures are interchangeable with those of the transform chains
+  bool result = false;
+  bufferSource(DATA) >> verifierFilter(digestAlgo, pKey, keyInfo.type, sig) >> boolSink(result);
+  BOOST_CHECK_EQUAL(result, true);
+  BOOST_CHECK_EQUAL(EvpCrypto::verify(digestAlgo, pKey, keyInfo.type, {DATA}, sig), true);
+
+  OBufferStream os;
+  bufferSource(DATA) >> signerFilter(digestAlgo, *sKey, keyInfo.type) >> streamSink(os);
+  auto chainSig = os.buf();
+  BOOST_CHECK_EQUAL(EvpCrypto::verify(digestAlgo, pKey, keyInfo.type, {DATA1, DATA2}, *chainSig),
+                    true);
+
+  BOOST_CHECK_EQUAL(EvpCrypto::verify(digestAlgo, pKey, keyInfo.type, {DATA1}, sig), false);
+  BOOST_CHECK_EQUAL(EvpCrypto::verify(digestAlgo, pKey, keyInfo.type, {DATA},
+                                      make_span(sig).first(sig.size() - 1)), false);
+
+  // the output is too short
+  Buffer shortSig(maxSigSize / 2);
+  BOOST_CHECK_EQUAL(EvpCrypto::sign(digestAlgo, *sKey, keyInfo.type, {DATA}, shortSig), 0);
+  BOOST_CHECK_EQUAL(EvpCrypto::sign(DigestAlgorithm::NONE, *sKey, keyInfo.type, {DATA}, sig), 0);
+
+  PrivateKey emptyKey;
+  BOOST_CHECK_EQUAL(EvpCrypto::getMaxSignatureSize(emptyKey), 0);
+  BOOST_CHECK_EQUAL(EvpCrypto::sign(digestAlgo, emptyKey, keyInfo.type, {DATA}, sig), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Sm2Precomputed)
+{
+  auto sKey = generatePrivateKey(sm2KeyParams());
+  sKey->setSm2Alias();
+  PublicKey pKey;
+  pKey.loadPkcs8(*sKey->derivePublicKey());
+  pKey.setSm2Alias();
+
+  Buffer sig(EvpCrypto::getMaxSignatureSize(*sKey));
+  size_t sigSize = EvpCrypto::sign(DigestAlgorithm::SM3, *sKey, KeyType::SM2, {DATA}, sig);
+  BOOST_REQUIRE_GT(sigSize, 0);
+  sig.resize(sigSize);
+
+  BOOST_CHECK(EvpCrypto::verify(DigestAlgorithm::SM3, pKey, KeyType::SM2, {DATA}, sig));
+  BOOST_CHECK(!EvpCrypto::verify(DigestAlgorithm::SM3, pKey, KeyType::SM2, {DATA2}, sig));
+
+  bool result = false;
+  bufferSource(DATA) >> verifierFilter(DigestAlgorithm::SM3, pKey, KeyType::SM2, sig)
+                     >> boolSink(result);
+  BOOST_CHECK_EQUAL(result, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestEvpCrypto
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // namespace detail
+} // namespace security
+} // namespace ndn
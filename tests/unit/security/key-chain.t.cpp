@@ -592,6 +592,79 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(SigningInterface, T, SigningTests, T)
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(SignBatch, KeyChainFixture)
+{
+  const std::vector<SigningInfo> signingInfos = {
+    signingByIdentity(m_keyChain.createIdentity("/TestKeyChain/SignBatch/EC", EcKeyParams())),
+    signingByIdentity(m_keyChain.createIdentity("/TestKeyChain/SignBatch/RSA", RsaKeyParams())),
+    signingByIdentity(m_keyChain.createIdentity("/TestKeyChain/SignBatch/SM2", sm2KeyParams())),
+    signingWithSha256(),
+  };
+
+  for (const auto& signingInfo : signingInfos) {
+    BOOST_TEST_CONTEXT("SigningInfo = " << signingInfo) {
+      std::vector<Data> data;
+      for (uint64_t i = 0; i < 10; ++i) {
+        data.emplace_back(Name("/TestKeyChain/SignBatch/data").appendSegment(i));
+        data.back().setContent(makeNonNegativeIntegerBlock(tlv::Content, i));
+      }
+      Data single(data.back());
+      m_keyChain.sign(single, signingInfo);
+
+      m_keyChain.signBatch(data, signingInfo, 3);
+
+      for (const auto& datum : data) {
+        BOOST_CHECK_EQUAL(datum.getSignatureInfo(), single.getSignatureInfo());
+        if (signingInfo.getSignerType() == SigningInfo::SIGNER_TYPE_ID) {
+          BOOST_CHECK(verifySignature(datum, signingInfo.getPibIdentity().getDefaultKey()));
+        }
+        else {
+          BOOST_CHECK(verifySignature(datum, nullopt));
+        }
+      }
+      if (signingInfo.getSignerType() == SigningInfo::SIGNER_TYPE_SHA256) {
+        BOOST_CHECK_EQUAL(data.back().wireEncode(), single.wireEncode());
+      }
+    }
+  }
+
+  BOOST_CHECK_NO_THROW(m_keyChain.signBatch({}, signingWithSha256(), 3));
+  std::vector<Data> data(2);
+  BOOST_CHECK_THROW(m_keyChain.signBatch(data, signingByIdentity("/non-existing/identity")),
+                    KeyChain::InvalidSigningInfoError);
+}
+
+BOOST_FIXTURE_TEST_CASE(SignDataBufferSize, KeyChainFixture)
+{
+  const std::vector<SigningInfo> signingInfos = {
+    signingByIdentity(m_keyChain.createIdentity("/TestKeyChain/BufferSize/EC", EcKeyParams())),
+    signingByIdentity(m_keyChain.createIdentity("/TestKeyChain/BufferSize/RSA", RsaKeyParams())),
+    signingByIdentity(m_keyChain.createIdentity("/TestKeyChain/BufferSize/SM2", sm2KeyParams())),
+    signingWithSha256(),
+  };
+
+  for (const auto& signingInfo : signingInfos) {
+    for (size_t contentSize : {0, 100, 20000}) {
+      BOOST_TEST_CONTEXT("SigningInfo = " << signingInfo << ", content size = " << contentSize) {
+        Data data("/TestKeyChain/SignDataBufferSize/data");
+        data.setContent(std::vector<uint8_t>(contentSize, 0xcc));
+        m_keyChain.sign(data, signingInfo);
+
+        // the wire encoding is produced in a buffer sized for the packet, without reallocation
+        const Block& wire = data.wireEncode();
+        BOOST_CHECK_LE(wire.getBuffer()->size(), wire.size() + 512);
+        BOOST_CHECK_EQUAL(data.getContent().value_size(), contentSize);
+        if (signingInfo.getSignerType() == SigningInfo::SIGNER_TYPE_ID) {
+          BOOST_CHECK(verifySignature(data, signingInfo.getPibIdentity().getDefaultKey()));
+        }
+        else {
+          BOOST_CHECK(verifySignature(data, nullopt));
+        }
+      }
+    }
+  }
+}
+
 BOOST_FIXTURE_TEST_CASE(ImportPrivateKey, KeyChainFixture)
 {
   const Name keyName("/test/device2");
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/key-chain-fixture.hpp"
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace tests {
+
+using namespace ndn::tests;
+
+class PublicKeyCacheFixture : public KeyChainFixture
+{
+public:
+  PublicKeyCacheFixture()
+    : keyCache(2)
+  {
+    ecCert = m_keyChain.createIdentity("/TestPublicKeyCache/EC", EcKeyParams())
+             .getDefaultKey().getDefaultCertificate();
+    rsaCert = m_keyChain.createIdentity("/TestPublicKeyCache/RSA", RsaKeyParams())
+              .getDefaultKey().getDefaultCertificate();
+    sm2Cert = m_keyChain.createIdentity("/TestPublicKeyCache/SM2", sm2KeyParams())
+              .getDefaultKey().getDefaultCertificate();
+  }
+
+public:
+  PublicKeyCache keyCache;
+  Certificate ecCert;
+  Certificate rsaCert;
+  Certificate sm2Cert;
+};
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_FIXTURE_TEST_SUITE(TestPublicKeyCache, PublicKeyCacheFixture)
+
+BOOST_AUTO_TEST_CASE(Find)
+{
+  BOOST_CHECK_EQUAL(keyCache.getCapacity(), 2);
+  BOOST_CHECK_EQUAL(keyCache.size(), 0);
+
+  auto key = keyCache.find(ecCert, KeyType::EC);
+  BOOST_REQUIRE(key != nullptr);
+  BOOST_CHECK(key->getKeyType() == KeyType::EC);
+  BOOST_CHECK_EQUAL(keyCache.size(), 1);
+
+  // a second lookup returns the same parsed key
+  BOOST_CHECK_EQUAL(keyCache.find(ecCert, KeyType::EC), key);
+  BOOST_CHECK_EQUAL(keyCache.size(), 1);
+
+  keyCache.erase(ecCert.getName());
+  BOOST_CHECK_EQUAL(keyCache.size(), 0);
+  auto reparsed = keyCache.find(ecCert, KeyType::EC);
+  BOOST_CHECK_NE(reparsed, key);
+
+  keyCache.clear();
+  BOOST_CHECK_EQUAL(keyCache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ChangedKeyBits)
+{
+  auto key = keyCache.find(ecCert, KeyType::EC);
+  BOOST_REQUIRE(key != nullptr);
+
+  // a certificate that reuses the name of a cached certificate must not get the cached key
+  Certificate forged(ecCert);
+  forged.setContent(rsaCert.getContent());
+  BOOST_REQUIRE_EQUAL(forged.getName(), ecCert.getName());
+  auto forgedKey = keyCache.find(forged, KeyType::EC);
+  BOOST_REQUIRE(forgedKey != nullptr);
+  BOOST_CHECK_NE(forgedKey, key);
+  BOOST_CHECK(forgedKey->getKeyType() == KeyType::RSA);
+  BOOST_CHECK_EQUAL(keyCache.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidKeyBits)
+{
+  Certificate bad(ecCert);
+  bad.setContent(makeStringBlock(tlv::Content, "not a key"));
+  BOOST_CHECK(keyCache.find(bad, KeyType::EC) == nullptr);
+  BOOST_CHECK_EQUAL(keyCache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Eviction)
+{
+  auto ecKey = keyCache.find(ecCert, KeyType::EC);
+  auto rsaKey = keyCache.find(rsaCert, KeyType::RSA);
+  // touch the EC key, so that the RSA key becomes the least recently used
+  BOOST_CHECK_EQUAL(keyCache.find(ecCert, KeyType::EC), ecKey);
+
+  keyCache.find(sm2Cert, KeyType::SM2);
+  BOOST_CHECK_EQUAL(keyCache.size(), 2);
+  BOOST_CHECK_EQUAL(keyCache.find(ecCert, KeyType::EC), ecKey);
+  BOOST_CHECK_NE(keyCache.find(rsaCert, KeyType::RSA), rsaKey);
+  BOOST_CHECK_EQUAL(keyCache.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Verify)
+{
+  for (const auto& cert : {ecCert, rsaCert, sm2Cert}) {
+    Data data("/TestPublicKeyCache/data");
+    m_keyChain.sign(data, signingByCertificate(cert));
+
+    BOOST_CHECK(verifySignature(data, cert, keyCache));
+    // the second verification uses the cached key
+    BOOST_CHECK(verifySignature(data, cert, keyCache));
+
+    Data wrongData(data);
+    wrongData.setContent(makeStringBlock(tlv::Content, "changed"));
+    BOOST_CHECK(!verifySignature(wrongData, cert, keyCache));
+  }
+
+  Interest interest("/TestPublicKeyCache/interest");
+  m_keyChain.sign(interest, signingByCertificate(sm2Cert));
+  BOOST_CHECK(verifySignature(interest, sm2Cert, keyCache));
+  BOOST_CHECK(!verifySignature(interest, ecCert, keyCache));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPublicKeyCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -682,6 +682,27 @@ BOOST_AUTO_TEST_CASE(Sm2Decryption)
 
 #endif
 
+BOOST_AUTO_TEST_CASE(IsSm2Key)
+{
+  const std::string privateKeyPkcs1 =
+    "MHcCAQEEIJqY+6mfM4btu3IWkmcZV6J3g+wih5QyrJ2jbWoh/nn5oAoGCCqBHM9V\n"
+    "AYItoUQDQgAEfyGr6PC52r9m4eY4ng8DFP7t+wsHNf1uFIWhVrKfe3wE+IWV957R\n"
+    "y1kB0/uBvJiDnNIxoBngRV/ErEDjl6rKJA==\n";
+
+  PrivateKey sKey;
+  BOOST_CHECK_THROW(sKey.isSm2Key(), PrivateKey::Error);
+  sKey.loadPkcs1Base64({reinterpret_cast<const uint8_t*>(privateKeyPkcs1.data()),
+                        privateKeyPkcs1.size()});
+  // an SM2 key is loaded as an EC key, and is recognized by its curve
+  BOOST_CHECK_EQUAL(sKey.getKeyType(), KeyType::EC);
+  BOOST_CHECK_EQUAL(sKey.isSm2Key(), true);
+  sKey.setSm2Alias();
+  BOOST_CHECK_EQUAL(sKey.isSm2Key(), true);
+
+  BOOST_CHECK_EQUAL(generatePrivateKey(sm2KeyParams())->isSm2Key(), true);
+  BOOST_CHECK_EQUAL(generatePrivateKey(EcKeyParams())->isSm2Key(), false);
+  BOOST_CHECK_EQUAL(generatePrivateKey(RsaKeyParams())->isSm2Key(), false);
+}
 
 BOOST_AUTO_TEST_CASE(UnsupportedDecryption)
 {
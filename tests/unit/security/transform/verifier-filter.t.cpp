@@ -228,6 +228,70 @@ BOOST_AUTO_TEST_CASE(Sm2)
   
 	BOOST_CHECK_EQUAL(result, true);
 }
+
+BOOST_AUTO_TEST_CASE(Sm2Precomputed)
+{
+  const std::string privateKeyPkcs1 =
+    "MHcCAQEEIJqY+6mfM4btu3IWkmcZV6J3g+wih5QyrJ2jbWoh/nn5oAoGCCqBHM9V\n"
+    "AYItoUQDQgAEfyGr6PC52r9m4eY4ng8DFP7t+wsHNf1uFIWhVrKfe3wE+IWV957R\n"
+    "y1kB0/uBvJiDnNIxoBngRV/ErEDjl6rKJA==\n";
+  const std::string publicKeyPkcs8 =
+    "MFkwEwYHKoZIzj0CAQYIKoEcz1UBgi0DQgAEfyGr6PC52r9m4eY4ng8DFP7t+wsH\n"
+    "Nf1uFIWhVrKfe3wE+IWV957Ry1kB0/uBvJiDnNIxoBngRV/ErEDjl6rKJA==\n";
+  const uint8_t otherData[] = {0x01, 0x02, 0x03, 0x05};
+
+  auto loadPrivateKey = [&] {
+    auto key = make_unique<PrivateKey>();
+    key->loadPkcs1Base64({reinterpret_cast<const uint8_t*>(privateKeyPkcs1.data()),
+                          privateKeyPkcs1.size()});
+    return key;
+  };
+  auto loadPublicKey = [&] {
+    auto key = make_unique<PublicKey>();
+    key->loadPkcs8Base64({reinterpret_cast<const uint8_t*>(publicKeyPkcs8.data()),
+                          publicKeyPkcs8.size()});
+    return key;
+  };
+  auto sign = [] (const PrivateKey& key, span<const uint8_t> data) {
+    OBufferStream os;
+    bufferSource(data) >> signerFilter(DigestAlgorithm::SM3, key, KeyType::SM2) >> streamSink(os);
+    return os.buf();
+  };
+  auto verify = [] (const PublicKey& key, span<const uint8_t> data, const Buffer& sig) {
+    bool result = false;
+    bufferSource(data) >> verifierFilter(DigestAlgorithm::SM3, key, KeyType::SM2, sig)
+                       >> boolSink(result);
+    return result;
+  };
+
+  auto sKey = loadPrivateKey();
+  auto pKey = loadPublicKey();
+  auto sKeyPrecomputed = loadPrivateKey();
+  sKeyPrecomputed->setSm2Alias();
+  sKeyPrecomputed->setSm2Alias(); // no effect
+  auto pKeyPrecomputed = loadPublicKey();
+  pKeyPrecomputed->setSm2Alias();
+
+  // signatures are interchangeable between the precomputed and per-packet contexts
+  for (int i = 0; i < 3; ++i) {
+    auto sig = sign(*sKey, DATA);
+    auto sigPrecomputed = sign(*sKeyPrecomputed, DATA);
+    BOOST_CHECK(verify(*pKey, DATA, *sigPrecomputed));
+    BOOST_CHECK(verify(*pKeyPrecomputed, DATA, *sigPrecomputed));
+    BOOST_CHECK(verify(*pKeyPrecomputed, DATA, *sig));
+    BOOST_CHECK(!verify(*pKeyPrecomputed, otherData, *sig));
+    BOOST_CHECK(!verify(*pKeyPrecomputed, otherData, *sigPrecomputed));
+  }
+
+  // other digest algorithms do not use the precomputed context
+  OBufferStream os;
+  bufferSource(DATA) >> signerFilter(DigestAlgorithm::SHA256, *sKeyPrecomputed, KeyType::SM2)
+                     >> streamSink(os);
+  BOOST_CHECK(!verify(*pKeyPrecomputed, DATA, *os.buf()));
+
+  PrivateKey emptyKey;
+  BOOST_CHECK_THROW(emptyKey.setSm2Alias(), PrivateKey::Error);
+}
 #endif
 
 
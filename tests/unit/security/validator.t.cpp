@@ -143,12 +143,15 @@ BOOST_AUTO_TEST_CASE(TrustedCertCaching)
   VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
   face.sentInterests.clear();
+  // keys of the trust anchor and of the retrieved cert
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().size(), 2);
 
   processInterest = nullptr; // disable data responses from mocked network
 
   VALIDATE_SUCCESS(data, "Should get accepted, based on the cached trusted cert");
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
   face.sentInterests.clear();
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().size(), 2);
 
   advanceClocks(1_h, 2); // expire trusted cache
 
@@ -172,6 +175,39 @@ BOOST_AUTO_TEST_CASE(ResetVerifiedCertificates)
   VALIDATE_FAILURE(data, "Should fail, as no trusted cache or anchors");
 }
 
+BOOST_AUTO_TEST_CASE(ValidateBatch)
+{
+  std::vector<Data> data;
+  for (uint64_t i = 0; i < 6; ++i) {
+    data.emplace_back(Name("/Security/ValidatorFixture/Sub1/Sub2/Data").appendSegment(i));
+    m_keyChain.sign(data.back(), signingByIdentity(subIdentity));
+  }
+  data.emplace_back("/Security/ValidatorFixture/Sub1/Sub2/Anchor");
+  m_keyChain.sign(data.back(), signingByIdentity(identity));
+  data.emplace_back("/Security/ValidatorFixture/Sub1/Sub2/Tampered");
+  m_keyChain.sign(data.back(), signingByIdentity(subIdentity));
+  data.back().setContent(makeStringBlock(tlv::Content, "tampered"));
+  data.emplace_back("/Security/ValidatorFixture/Sub1/Sub2/Other");
+  m_keyChain.sign(data.back(), signingByIdentity(otherIdentity));
+
+  validator.setVerificationThreads(4);
+  BOOST_CHECK_EQUAL(validator.getVerificationThreads(), 4);
+
+  std::set<Name> accepted;
+  std::set<Name> rejected;
+  validator.validateBatch(data,
+                          [&] (const Data& d) { accepted.insert(d.getName()); },
+                          [&] (const Data& d, const ValidationError&) { rejected.insert(d.getName()); });
+  mockNetworkOperations();
+
+  BOOST_CHECK_EQUAL(accepted.size(), 7);
+  BOOST_CHECK_EQUAL(rejected.size(), 2);
+  BOOST_CHECK_EQUAL(rejected.count("/Security/ValidatorFixture/Sub1/Sub2/Tampered"), 1);
+  BOOST_CHECK_EQUAL(rejected.count("/Security/ValidatorFixture/Sub1/Sub2/Other"), 1);
+  // the certificate of subIdentity is retrieved only once for the whole batch
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(UntrustedCertCaching)
 {
   Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2020 Regents of the University of California.
+ * Copyright (c) 2013-2022 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -20,9 +20,18 @@
  */
 
 #include "ndn-cxx/transport/unix-transport.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
 
 #include "tests/boost-test.hpp"
 
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+
+#include <thread>
+
 namespace ndn {
 namespace tests {
 
@@ -30,6 +39,153 @@ BOOST_AUTO_TEST_SUITE(Transport)
 BOOST_AUTO_TEST_SUITE(TestUnixTransport)
 
 using ndn::Transport;
+using boost::asio::local::stream_protocol;
+
+/** \brief Connects a UnixTransport to a stand-in forwarder listening in the test directory
+ */
+class UnixTransportFixture
+{
+protected:
+  UnixTransportFixture()
+    : m_acceptor(m_io, makeEndpoint())
+    , m_socket(m_io)
+    , m_transport(SOCKET_PATH)
+  {
+  }
+
+  ~UnixTransportFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove(SOCKET_PATH, ec);
+  }
+
+  /** \brief Starts connecting the transport; it becomes connected once the I/O is run
+   */
+  void
+  startConnect()
+  {
+    m_acceptor.async_accept(m_socket, [this] (const auto& error) {
+      BOOST_REQUIRE(!error);
+      m_isAccepted = true;
+      if (!m_forwarderBuffer.empty()) {
+        startForwarderRead();
+      }
+    });
+    m_transport.connect(m_io, [this] (const Block& block) {
+      if (m_onReceive) {
+        m_onReceive(block);
+      }
+    });
+  }
+
+  void
+  connect()
+  {
+    startConnect();
+    BOOST_REQUIRE(runUntil([this] { return m_isAccepted && m_transport.isConnected(); }));
+  }
+
+  /** \brief Makes the stand-in forwarder read exactly \p nBytes octets once it has accepted
+   */
+  void
+  readOnForwarder(size_t nBytes)
+  {
+    m_forwarderBuffer.resize(nBytes);
+    m_hasForwarderRead = false;
+    if (m_isAccepted) {
+      startForwarderRead();
+    }
+  }
+
+private:
+  void
+  startForwarderRead()
+  {
+    boost::asio::async_read(m_socket, boost::asio::buffer(m_forwarderBuffer),
+                            [this] (const auto& error, size_t) {
+                              BOOST_REQUIRE(!error);
+                              m_hasForwarderRead = true;
+                            });
+  }
+
+protected:
+  /** \brief Makes the stand-in forwarder write \p bytes to the connected transport
+   */
+  void
+  writeOnForwarder(std::vector<uint8_t> bytes)
+  {
+    BOOST_REQUIRE(m_isAccepted);
+    auto buffer = std::make_shared<std::vector<uint8_t>>(std::move(bytes));
+    boost::asio::async_write(m_socket, boost::asio::buffer(*buffer),
+                             [buffer] (const auto& error, size_t) { BOOST_REQUIRE(!error); });
+  }
+
+  /** \brief Runs the I/O until \p isDone returns true, for at most 5 seconds
+   */
+  template<typename Predicate>
+  bool
+  runUntil(const Predicate& isDone)
+  {
+    for (int i = 0; i < 500 && !isDone(); ++i) {
+      m_io.poll();
+#if BOOST_VERSION >= 106600
+      m_io.restart();
+#else
+      m_io.reset();
+#endif
+      if (!isDone()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    }
+    return isDone();
+  }
+
+  static std::vector<Block>
+  makePackets(size_t nPackets, size_t valueSize)
+  {
+    std::vector<Block> packets;
+    for (size_t i = 0; i < nPackets; ++i) {
+      std::vector<uint8_t> value(valueSize, static_cast<uint8_t>(i));
+      packets.push_back(makeBinaryBlock(tlv::Content, value));
+    }
+    return packets;
+  }
+
+  static std::vector<uint8_t>
+  concatenate(const std::vector<Block>& packets)
+  {
+    std::vector<uint8_t> bytes;
+    for (const auto& packet : packets) {
+      bytes.insert(bytes.end(), packet.begin(), packet.end());
+    }
+    return bytes;
+  }
+
+private:
+  static stream_protocol::endpoint
+  makeEndpoint()
+  {
+    boost::filesystem::create_directories(UNIT_TESTS_TMPDIR);
+    boost::system::error_code ec;
+    boost::filesystem::remove(SOCKET_PATH, ec);
+    return stream_protocol::endpoint(SOCKET_PATH);
+  }
+
+protected:
+  static const std::string SOCKET_PATH;
+
+  boost::asio::io_service m_io;
+  stream_protocol::acceptor m_acceptor;
+  stream_protocol::socket m_socket;
+  bool m_isAccepted = false;
+  std::vector<uint8_t> m_forwarderBuffer;
+  bool m_hasForwarderRead = false;
+  UnixTransport m_transport;
+  std::function<void(const Block&)> m_onReceive;
+};
+
+const std::string UnixTransportFixture::SOCKET_PATH =
+  (boost::filesystem::path(UNIT_TESTS_TMPDIR) / "unix-transport.sock").string();
 
 BOOST_AUTO_TEST_CASE(GetSocketNameFromUri)
 {
@@ -51,6 +207,117 @@ BOOST_AUTO_TEST_CASE(GetSocketNameFromUri)
                         });
 }
 
+BOOST_FIXTURE_TEST_SUITE(WriteBatching, UnixTransportFixture)
+
+BOOST_AUTO_TEST_CASE(Coalesce)
+{
+  auto packets = makePackets(10, 100);
+  const size_t packetSize = packets.front().size();
+  readOnForwarder(10 * packetSize);
+
+  // packets sent before the connection is established are written in one batch
+  startConnect();
+  for (size_t i = 0; i < 5; ++i) {
+    m_transport.send(packets[i]);
+  }
+  BOOST_REQUIRE(runUntil([this] { return m_transport.getWriteCounters().nPackets == 5; }));
+  BOOST_CHECK_EQUAL(m_transport.getWriteCounters().nBatches, 1);
+
+  // the first packet is written right away, and those sent during its write are coalesced
+  for (size_t i = 5; i < 10; ++i) {
+    m_transport.send(packets[i]);
+  }
+  BOOST_REQUIRE(runUntil([this] { return m_hasForwarderRead; }));
+  BOOST_CHECK(m_forwarderBuffer == concatenate(packets));
+
+  const auto& counters = m_transport.getWriteCounters();
+  BOOST_CHECK_EQUAL(counters.nBatches, 3);
+  BOOST_CHECK_EQUAL(counters.nPackets, 10);
+  BOOST_CHECK_EQUAL(counters.nBytes, 10 * packetSize);
+  BOOST_CHECK_EQUAL(counters.maxBatchPackets, 5);
+}
+
+BOOST_AUTO_TEST_CASE(Limit)
+{
+  auto packets = makePackets(10, 100);
+  const size_t packetSize = packets.front().size();
+  readOnForwarder(10 * packetSize);
+
+  m_transport.setMaxWriteBatchSize(3 * packetSize + 1);
+  startConnect();
+  for (const auto& packet : packets) {
+    m_transport.send(packet);
+  }
+  BOOST_REQUIRE(runUntil([this] { return m_hasForwarderRead; }));
+  BOOST_CHECK(m_forwarderBuffer == concatenate(packets));
+
+  const auto& counters = m_transport.getWriteCounters();
+  BOOST_CHECK_EQUAL(counters.nBatches, 4);
+  BOOST_CHECK_EQUAL(counters.nPackets, 10);
+  BOOST_CHECK_EQUAL(counters.nBytes, 10 * packetSize);
+  BOOST_CHECK_EQUAL(counters.maxBatchPackets, 3);
+}
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  auto packets = makePackets(4, 100);
+  auto large = makePackets(1, 1000);
+  packets.insert(packets.begin() + 2, large.front());
+  readOnForwarder(concatenate(packets).size());
+
+  // a packet larger than the limit is written on its own, as is every packet with no limit
+  m_transport.setMaxWriteBatchSize(0);
+  startConnect();
+  for (const auto& packet : packets) {
+    m_transport.send(packet);
+  }
+  BOOST_REQUIRE(runUntil([this] { return m_hasForwarderRead; }));
+  BOOST_CHECK(m_forwarderBuffer == concatenate(packets));
+
+  const auto& counters = m_transport.getWriteCounters();
+  BOOST_CHECK_EQUAL(counters.nBatches, 5);
+  BOOST_CHECK_EQUAL(counters.nPackets, 5);
+  BOOST_CHECK_EQUAL(counters.maxBatchPackets, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // WriteBatching
+
+BOOST_FIXTURE_TEST_CASE(ReceiveSharedChunk, UnixTransportFixture)
+{
+  // enough packets to fill several receive chunks
+  auto packets = makePackets(200, 2000);
+  std::vector<Block> retained;
+  size_t nReceived = 0;
+  m_onReceive = [&] (const Block& block) {
+    BOOST_REQUIRE_LT(nReceived, packets.size());
+    BOOST_CHECK_EQUAL(block, packets[nReceived]);
+    // retain a few packets, so that only chunks referenced by none of them can be reused
+    if (nReceived < 2 || nReceived % 50 == 0) {
+      retained.push_back(block);
+    }
+    ++nReceived;
+  };
+
+  m_transport.setReceiveMode(Transport::ReceiveMode::SHARED_CHUNK);
+  connect();
+  m_transport.resume();
+  writeOnForwarder(concatenate(packets));
+  BOOST_REQUIRE(runUntil([&] { return nReceived == packets.size(); }));
+
+  // consecutive packets share a chunk instead of being copied
+  BOOST_REQUIRE_EQUAL(retained.size(), 5);
+  BOOST_CHECK_EQUAL(retained[0].getBuffer(), retained[1].getBuffer());
+  BOOST_CHECK_NE(retained[0].getBuffer(), retained[2].getBuffer());
+
+  // a chunk still referenced by a retained Block has not been overwritten
+  for (size_t i = 0; i < retained.size(); ++i) {
+    size_t index = i < 2 ? i : (i - 1) * 50;
+    BOOST_TEST_CONTEXT("packet " << index) {
+      BOOST_CHECK_EQUAL(retained[i], packets[index]);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnixTransport
 BOOST_AUTO_TEST_SUITE_END() // Transport
 
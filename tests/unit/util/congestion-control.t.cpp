@@ -0,0 +1,238 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/congestion-control.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+using Seconds = time::duration<double, time::seconds::period>;
+
+/**
+ * @brief Delivers one window of segments per RTT over a link of fixed bandwidth.
+ *
+ * Segments beyond the bandwidth-delay product wait in the bottleneck queue, which increases
+ * the RTT of the whole window.
+ */
+static void
+simulateRounds(CongestionControl& cc, time::steady_clock::TimePoint& now, int nRounds,
+               double bandwidth = 1000.0, time::nanoseconds propDelay = 100_ms)
+{
+  double bdp = bandwidth * time::duration_cast<Seconds>(propDelay).count();
+  for (int i = 0; i < nRounds; ++i) {
+    auto nSegments = static_cast<int>(cc.getCwnd());
+    double queue = std::max(0.0, nSegments - bdp);
+    auto rtt = propDelay + time::duration_cast<time::nanoseconds>(Seconds(queue / bandwidth));
+    for (int j = 0; j < nSegments; ++j) {
+      cc.onAck(now + rtt * (j + 1) / nSegments, rtt);
+    }
+    now += rtt;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_AUTO_TEST_SUITE(TestCongestionControl)
+
+BOOST_AUTO_TEST_CASE(Aimd)
+{
+  AimdCongestionControl::Options options;
+  options.initCwnd = 2.0;
+  options.initSsthresh = 4.0;
+  AimdCongestionControl cc(options);
+  time::steady_clock::TimePoint now;
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 2.0);
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), 4.0);
+
+  cc.onAck(now, 10_ms);
+  cc.onAck(now, nullopt);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 4.0); // slow start
+  cc.onAck(now, 10_ms);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 4.25); // congestion avoidance
+
+  cc.onCongestion(now);
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), 2.125);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 2.125);
+  cc.onCongestion(now);
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), CongestionControl::MIN_SSTHRESH);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), CongestionControl::MIN_SSTHRESH);
+
+  options.resetCwndToInit = true;
+  options.initCwnd = 1.0;
+  AimdCongestionControl cc2(options);
+  cc2.onAck(now, 10_ms);
+  cc2.onAck(now, 10_ms);
+  cc2.onAck(now, 10_ms);
+  cc2.onAck(now, 10_ms);
+  cc2.onCongestion(now);
+  BOOST_CHECK_EQUAL(cc2.getSsthresh(), 2.125);
+  BOOST_CHECK_EQUAL(cc2.getCwnd(), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(Cubic)
+{
+  CubicCongestionControl cc;
+  time::steady_clock::TimePoint now;
+
+  simulateRounds(cc, now, 7); // slow start: 1, 2, 4, ..., 128
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 128.0);
+
+  cc.onCongestion(now);
+  BOOST_CHECK_CLOSE(cc.getCwnd(), 128.0 * 0.7, 0.001);
+  BOOST_CHECK_CLOSE(cc.getSsthresh(), 128.0 * 0.7, 0.001);
+
+  // K = cbrt(128 * 0.3 / 0.4), about 4.6 seconds; the window regains its previous size
+  // around that time, and keeps it for a while
+  time::steady_clock::TimePoint epochStart = now;
+  while (now - epochStart < 4_s) {
+    simulateRounds(cc, now, 1);
+  }
+  BOOST_CHECK_GT(cc.getCwnd(), 120.0);
+  BOOST_CHECK_LT(cc.getCwnd(), 128.0);
+  while (now - epochStart < 5_s) {
+    simulateRounds(cc, now, 1);
+  }
+  BOOST_CHECK_CLOSE(cc.getCwnd(), 128.0, 1.0);
+
+  // then probes beyond it, faster and faster
+  while (now - epochStart < 8_s) {
+    simulateRounds(cc, now, 1);
+  }
+  double cwnd8s = cc.getCwnd();
+  BOOST_CHECK_GT(cwnd8s, 140.0);
+  while (now - epochStart < 10_s) {
+    simulateRounds(cc, now, 1);
+  }
+  BOOST_CHECK_GT(cc.getCwnd() - cwnd8s, cwnd8s - 128.0);
+
+  // fast convergence: a reduction before regaining the previous size lowers the plateau
+  double cwnd = cc.getCwnd();
+  cc.onCongestion(now);
+  simulateRounds(cc, now, 1);
+  cc.onCongestion(now);
+  double plateau = cc.getCwnd() / 0.7 * (1.0 + 0.7) / 2.0;
+  BOOST_CHECK_LT(plateau, cwnd);
+}
+
+BOOST_AUTO_TEST_CASE(CubicTcpFriendliness)
+{
+  // With a short RTT, CUBIC grows slower than AIMD would, so the AIMD estimate takes over
+  CubicCongestionControl::Options options;
+  options.initSsthresh = 10.0;
+  CubicCongestionControl cc(options);
+  time::steady_clock::TimePoint now;
+
+  simulateRounds(cc, now, 4, 1000.0, 1_ms);
+  cc.onCongestion(now);
+  double cwnd = cc.getCwnd();
+  simulateRounds(cc, now, 20, 1000.0, 1_ms);
+  BOOST_CHECK_GT(cc.getCwnd(), cwnd + 20 * 3.0 * 0.3 / 1.7 - 1.0);
+
+  options.enableTcpFriendliness = false;
+  CubicCongestionControl cc2(options);
+  simulateRounds(cc2, now, 4, 1000.0, 1_ms);
+  cc2.onCongestion(now);
+  simulateRounds(cc2, now, 20, 1000.0, 1_ms);
+  BOOST_CHECK_LT(cc2.getCwnd(), cc.getCwnd());
+}
+
+BOOST_AUTO_TEST_CASE(Bbr)
+{
+  BbrCongestionControl cc;
+  time::steady_clock::TimePoint now;
+  BOOST_CHECK(cc.getMode() == BbrCongestionControl::Mode::STARTUP);
+  BOOST_CHECK_EQUAL(cc.getBdp(), 0.0);
+
+  // 1000 segments/s with 100 ms of propagation delay: the BDP is 100 segments
+  simulateRounds(cc, now, 4);
+  BOOST_CHECK(cc.getMode() == BbrCongestionControl::Mode::STARTUP);
+  BOOST_CHECK_GT(cc.getBdp(), 0.0);
+
+  simulateRounds(cc, now, 16);
+  BOOST_CHECK(cc.getMode() == BbrCongestionControl::Mode::PROBE_BW);
+  BOOST_CHECK_CLOSE(cc.getBdp(), 100.0, 10.0);
+
+  // the window cycles around the BDP, so that the queue stays short
+  double minCwnd = std::numeric_limits<double>::max();
+  double maxCwnd = 0.0;
+  for (int i = 0; i < 16; ++i) {
+    simulateRounds(cc, now, 1);
+    minCwnd = std::min(minCwnd, cc.getCwnd());
+    maxCwnd = std::max(maxCwnd, cc.getCwnd());
+  }
+  BOOST_CHECK_GT(minCwnd, 70.0);
+  BOOST_CHECK_LT(maxCwnd, 135.0);
+  BOOST_CHECK_GT(maxCwnd, 110.0);
+  BOOST_CHECK_CLOSE(cc.getBandwidth(), 1000.0, 10.0);
+
+  // a congestion event caps the window at the BDP instead of halving it
+  simulateRounds(cc, now, 1);
+  cc.onCongestion(now);
+  BOOST_CHECK_LE(cc.getCwnd(), cc.getBdp());
+  BOOST_CHECK_GT(cc.getCwnd(), 0.8 * cc.getBdp());
+}
+
+BOOST_AUTO_TEST_CASE(BbrCongestionInStartup)
+{
+  BbrCongestionControl cc;
+  time::steady_clock::TimePoint now;
+
+  // grow the window beyond the BDP of 100 segments, until it builds up a queue
+  while (cc.getCwnd() < 150.0) {
+    simulateRounds(cc, now, 1);
+  }
+  BOOST_CHECK(cc.getMode() == BbrCongestionControl::Mode::STARTUP);
+
+  // a loss ends startup and caps the window at the BDP
+  cc.onCongestion(now);
+  BOOST_CHECK(cc.getMode() == BbrCongestionControl::Mode::DRAIN);
+  BOOST_CHECK_CLOSE(cc.getBdp(), 100.0, 10.0);
+  BOOST_CHECK_LE(cc.getCwnd(), cc.getBdp());
+
+  simulateRounds(cc, now, 2);
+  BOOST_CHECK(cc.getMode() == BbrCongestionControl::Mode::PROBE_BW);
+  BOOST_CHECK_LT(cc.getCwnd(), 135.0);
+}
+
+BOOST_AUTO_TEST_CASE(BbrCongestionBeforeModel)
+{
+  BbrCongestionControl::Options options;
+  options.initCwnd = 10.0;
+  BbrCongestionControl cc(options);
+  time::steady_clock::TimePoint now;
+
+  cc.onAck(now, nullopt);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 11.0);
+  cc.onCongestion(now);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 5.5);
+  BOOST_CHECK(cc.getMode() == BbrCongestionControl::Mode::STARTUP);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCongestionControl
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace tests
+} // namespace util
+} // namespace ndn
@@ -203,8 +203,215 @@ BOOST_AUTO_TEST_CASE(CancelAllWithScopedEventId) // Bug 3691
   BOOST_CHECK(true);
 }
 
+BOOST_AUTO_TEST_CASE(Counters)
+{
+  scheduler.schedule(10_ms, [] {});
+  scheduler.schedule(10_ms, [] {});
+  scheduler.schedule(20_ms, [] {});
+
+  advanceClocks(5_ms, 30_ms);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nWakeups, 2);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nExecutedEvents, 3);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().maxEventsPerWakeup, 2);
+}
+
+BOOST_AUTO_TEST_CASE(BatchSlack)
+{
+  scheduler.setBatchSlack(5_ms);
+  BOOST_CHECK_EQUAL(scheduler.getBatchSlack(), 5_ms);
+
+  std::vector<int> executed;
+  scheduler.schedule(10_ms, [&] { executed.push_back(1); });
+  scheduler.schedule(14_ms, [&] { executed.push_back(2); });
+  scheduler.schedule(16_ms, [&] { executed.push_back(3); });
+
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(executed.size(), 2);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nWakeups, 1);
+
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(executed.size(), 3);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nWakeups, 2);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().maxEventsPerWakeup, 2);
+}
+
+BOOST_AUTO_TEST_CASE(MaxEventsPerWakeup)
+{
+  scheduler.setMaxEventsPerWakeup(2);
+  BOOST_CHECK_EQUAL(scheduler.getMaxEventsPerWakeup(), 2);
+
+  size_t count = 0;
+  for (int i = 0; i < 5; ++i) {
+    scheduler.schedule(10_ms, [&] { ++count; });
+  }
+
+  // the remaining events are executed in immediate wakeups, without advancing the clock
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(count, 5);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nWakeups, 3);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().maxEventsPerWakeup, 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // General
 
+class TimerWheelFixture : public ndn::tests::IoFixture
+{
+protected:
+  Scheduler scheduler{m_io, Scheduler::Backend::TIMER_WHEEL};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TimerWheel, TimerWheelFixture)
+
+BOOST_AUTO_TEST_CASE(Events)
+{
+  std::vector<int> order;
+  scheduler.schedule(500_ms, [&] { order.push_back(3); });
+  EventId i = scheduler.schedule(1_s, [] { BOOST_ERROR("This event should not have been fired"); });
+  scheduler.schedule(250_ms, [&] { order.push_back(2); });
+  scheduler.schedule(2_ms, [&] { order.push_back(1); });
+  i.cancel();
+
+  advanceClocks(1_ms, 1);
+  BOOST_CHECK(order.empty());
+  advanceClocks(1_ms, 1);
+  BOOST_CHECK_EQUAL(order.size(), 1);
+  advanceClocks(25_ms, 1000_ms);
+  std::vector<int> expectedOrder{1, 2, 3};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(),
+                                expectedOrder.begin(), expectedOrder.end());
+}
+
+BOOST_AUTO_TEST_CASE(RoundUp)
+{
+  advanceClocks(300_us);
+
+  bool isFired = false;
+  scheduler.schedule(1500_us, [&] { isFired = true; });
+
+  // the event expires at 1.8 ms, and is executed at the next tick
+  advanceClocks(1_ms, 1);
+  BOOST_CHECK_EQUAL(isFired, false);
+  advanceClocks(600_us);
+  BOOST_CHECK_EQUAL(isFired, false);
+  advanceClocks(100_us);
+  BOOST_CHECK_EQUAL(isFired, true);
+}
+
+BOOST_AUTO_TEST_CASE(Levels)
+{
+  // expiration times that are stored at each level of the wheel, and cascaded down
+  const std::vector<time::nanoseconds> delays{10_ms, 100_ms, 5_s, 5_min, 5_h, 200_h, 20000_h};
+
+  std::vector<time::steady_clock::TimePoint> fireTimes(delays.size());
+  auto start = time::steady_clock::now();
+  for (size_t i = 0; i < delays.size(); ++i) {
+    scheduler.schedule(delays[i], [&, i] { fireTimes[i] = time::steady_clock::now(); });
+  }
+
+  advanceClocks(1_ms, 1000);
+  advanceClocks(1_s, 2_h);
+  advanceClocks(1_h, 20000_h);
+
+  for (size_t i = 0; i < delays.size(); ++i) {
+    BOOST_TEST_CONTEXT("delay " << delays[i]) {
+      BOOST_CHECK_GE(fireTimes[i] - start, delays[i]);
+      time::nanoseconds step = delays[i] < 1_s ? 1_ms : delays[i] < 2_h ? 1_s : 1_h;
+      BOOST_CHECK_LE(fireTimes[i] - start, delays[i] + step);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CancelAndReschedule)
+{
+  size_t count = 0;
+  std::vector<EventId> ids;
+  for (int i = 0; i < 1000; ++i) {
+    ids.push_back(scheduler.schedule(time::milliseconds(i % 300), [&] { ++count; }));
+  }
+  for (size_t i = 0; i < ids.size(); i += 2) {
+    ids[i].cancel();
+    BOOST_CHECK(!ids[i]);
+  }
+  BOOST_CHECK(ids[1]);
+
+  EventId selfEventId;
+  std::function<void()> reschedule = [&] {
+    ++count;
+    if (count < 510) {
+      selfEventId = scheduler.schedule(0_ms, reschedule);
+    }
+  };
+  scheduler.schedule(400_ms, reschedule);
+
+  advanceClocks(1_ms, 1000);
+  BOOST_CHECK_EQUAL(count, 510);
+  BOOST_CHECK(!ids[1]);
+}
+
+BOOST_AUTO_TEST_CASE(CallbackException)
+{
+  class MyException : public std::exception
+  {
+  };
+  scheduler.schedule(10_ms, [] { throw MyException{}; });
+
+  bool isCallbackInvoked = false;
+  scheduler.schedule(10_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
+
+  BOOST_CHECK_THROW(this->advanceClocks(6_ms, 2), MyException);
+  this->advanceClocks(1_us);
+  BOOST_CHECK(isCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_CASE(CancelAll)
+{
+  ScopedEventId eid = scheduler.schedule(10_ms, [] { BOOST_ERROR("This event should have been cancelled"); });
+  scheduler.schedule(1_s, [] { BOOST_ERROR("This event should have been cancelled"); });
+  scheduler.cancelAllEvents();
+  BOOST_CHECK(!eid);
+  eid.cancel(); // should not crash
+
+  bool isCallbackInvoked = false;
+  scheduler.schedule(10_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
+  advanceClocks(5_ms, 1_s);
+  BOOST_CHECK(isCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  scheduler.setBatchSlack(5_ms);
+  scheduler.setMaxEventsPerWakeup(3);
+
+  size_t count = 0;
+  for (int i = 0; i < 4; ++i) {
+    scheduler.schedule(10_ms, [&] { ++count; });
+  }
+  scheduler.schedule(14_ms, [&] { ++count; });
+  scheduler.schedule(20_ms, [&] { ++count; });
+
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(count, 5);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nWakeups, 2);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().maxEventsPerWakeup, 3);
+
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(count, 6);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nExecutedEvents, 6);
+}
+
+BOOST_AUTO_TEST_CASE(EventIdOutlivesScheduler)
+{
+  EventId eid;
+  {
+    Scheduler sched(m_io, Scheduler::Backend::TIMER_WHEEL);
+    eid = sched.schedule(10_ms, [] {});
+    BOOST_CHECK(eid);
+  }
+  BOOST_CHECK(!eid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TimerWheel
+
 BOOST_AUTO_TEST_SUITE(EventId)
 
 using scheduler::EventId;
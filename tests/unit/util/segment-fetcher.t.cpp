@@ -31,6 +31,11 @@
 
 #include <set>
 
+#include <boost/filesystem.hpp>
+#include <fcntl.h>
+#include <fstream>
+#include <unistd.h>
+
 namespace ndn {
 namespace util {
 namespace tests {
@@ -179,6 +184,17 @@ BOOST_AUTO_TEST_CASE(InvalidOptions)
   DummyValidator acceptValidator;
   BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
                     std::invalid_argument);
+
+  options = {};
+  options.outputFd = 0;
+  options.inOrder = true;
+  BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
+                    std::invalid_argument);
+
+  options = {};
+  options.resumeSegment = 5;
+  BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
+                    std::invalid_argument);
 }
 
 BOOST_AUTO_TEST_CASE(ExceedMaxTimeout)
@@ -246,14 +262,14 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
 
   face.receive(*makeDataSegment("/hello/world/version0", 0, false));
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 1);
@@ -261,7 +277,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 2);
@@ -269,7 +285,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 3);
@@ -277,7 +293,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 4);
@@ -285,7 +301,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 6);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 4);
@@ -299,7 +315,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
   BOOST_CHECK_EQUAL(nAfterSegmentValidated, 5);
   BOOST_CHECK_EQUAL(nAfterSegmentNacked, 1);
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
 }
 
 BOOST_AUTO_TEST_CASE(BasicMultipleSegments)
@@ -410,8 +426,8 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_timeLastSegmentReceived, time::steady_clock::now() - 10_ms);
   BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 0);
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, std::numeric_limits<double>::max());
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), std::numeric_limits<double>::max());
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 0);
@@ -423,8 +439,8 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
 
-  double oldCwnd = fetcher->m_cwnd;
-  double oldSsthresh = fetcher->m_ssthresh;
+  double oldCwnd = fetcher->m_cc->getCwnd();
+  double oldSsthresh = fetcher->m_cc->getSsthresh();
   uint64_t oldNextSegmentNum = fetcher->m_nextSegmentNum;
 
   face.receive(*makeDataSegment("/hello/world/version0", 0, false));
@@ -437,8 +453,8 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   // +2 below because m_nextSegmentNum will be incremented in the receive callback if segment 0 is
   // the first received
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum + fetcher->m_options.aiStep + 2);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd + fetcher->m_options.aiStep);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldSsthresh);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd + fetcher->m_options.aiStep);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldSsthresh);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, oldCwnd + fetcher->m_options.aiStep);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 14);
@@ -446,10 +462,10 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_highData, 0);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, 0);
   BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 1);
-  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cwnd);
-  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1 + fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cc->getCwnd());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1 + fetcher->m_cc->getCwnd());
 
-  oldCwnd = fetcher->m_cwnd;
+  oldCwnd = fetcher->m_cc->getCwnd();
   oldNextSegmentNum = fetcher->m_nextSegmentNum;
 
   face.receive(*makeDataSegment("/hello/world/version0", 2, false));
@@ -460,19 +476,19 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 0);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum + fetcher->m_options.aiStep + 1);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd + fetcher->m_options.aiStep);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldSsthresh);
-  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd + fetcher->m_options.aiStep);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldSsthresh);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cc->getCwnd());
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 28);
   BOOST_CHECK_EQUAL(fetcher->m_highInterest, fetcher->m_nextSegmentNum - 1);
   BOOST_CHECK_EQUAL(fetcher->m_highData, 2);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, 0);
   BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 2);
-  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cwnd);
-  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2 + fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cc->getCwnd());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2 + fetcher->m_cc->getCwnd());
 
-  oldCwnd = fetcher->m_cwnd;
+  oldCwnd = fetcher->m_cc->getCwnd();
   oldNextSegmentNum = fetcher->m_nextSegmentNum;
 
   face.receive(*makeDataSegment("/hello/world/version0", 1, false));
@@ -483,20 +499,20 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 0);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum + fetcher->m_options.aiStep + 1);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd + fetcher->m_options.aiStep);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldSsthresh);
-  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd + fetcher->m_options.aiStep);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldSsthresh);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cc->getCwnd());
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 42);
   BOOST_CHECK_EQUAL(fetcher->m_highInterest, fetcher->m_nextSegmentNum - 1);
   BOOST_CHECK_EQUAL(fetcher->m_highData, 2);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, 0);
   BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 3);
-  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cwnd);
-  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3 + fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cc->getCwnd());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3 + fetcher->m_cc->getCwnd());
 
-  oldCwnd = fetcher->m_cwnd;
-  oldSsthresh = fetcher->m_ssthresh;
+  oldCwnd = fetcher->m_cc->getCwnd();
+  oldSsthresh = fetcher->m_cc->getSsthresh();
   oldNextSegmentNum = fetcher->m_nextSegmentNum;
   size_t oldSentInterestsSize = face.sentInterests.size();
 
@@ -506,8 +522,8 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 1);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd / 2.0);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldCwnd / 2.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, oldCwnd - 1);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 42);
@@ -525,8 +541,8 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 1);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd / 2.0);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldCwnd / 2.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, oldCwnd - 1);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 42);
@@ -616,6 +632,47 @@ BOOST_AUTO_TEST_CASE(MoreSegmentsThanNSegments)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(ReassembleOutOfOrder)
+{
+  auto makeSegment = [] (uint64_t segment, const std::string& content, bool isFinal) {
+    auto data = makeDataSegment("/hello/world/version0", segment, isFinal);
+    data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+    return data;
+  };
+
+  for (bool inOrder : {false, true}) {
+    BOOST_TEST_CONTEXT("inOrder=" << inOrder) {
+      DummyValidator acceptValidator;
+      SegmentFetcher::Options options;
+      options.inOrder = inOrder;
+      options.initCwnd = 3.0;
+      options.useConstantCwnd = true;
+      auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+
+      std::string result;
+      fetcher->onComplete.connect([&] (ConstBufferPtr data) {
+        result.assign(data->begin(), data->end());
+      });
+      fetcher->onInOrderData.connect([&] (ConstBufferPtr data) {
+        result.append(data->begin(), data->end());
+      });
+      advanceClocks(10_ms);
+
+      face.receive(*makeSegment(0, "seg0-", false));
+      advanceClocks(10_ms);
+      face.receive(*makeSegment(3, "CC", true));
+      advanceClocks(10_ms);
+      BOOST_CHECK_EQUAL(result, inOrder ? "seg0-" : "");
+      face.receive(*makeSegment(1, "a", false));
+      advanceClocks(10_ms);
+      face.receive(*makeSegment(2, "bbbb", false));
+      advanceClocks(10_ms);
+
+      BOOST_CHECK_EQUAL(result, "seg0-abbbbCC");
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(DuplicateNack)
 {
   DummyValidator acceptValidator;
@@ -666,6 +723,42 @@ BOOST_AUTO_TEST_CASE(CongestionNack)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(PluggableCongestionControl)
+{
+  DummyValidator acceptValidator;
+  nSegments = 401;
+  segmentsToDropOrNack.push(100);
+  segmentsToDropOrNack.push(200);
+  sendNackInsteadOfDropping = true;
+  nackReason = lp::NackReason::CONGESTION;
+
+  SegmentFetcher::Options options;
+  options.initCwnd = 4.0;
+  int nCreated = 0;
+  options.makeCongestionControl = [&] (const SegmentFetcher::Options& opts) {
+    ++nCreated;
+    CubicCongestionControl::Options ccOptions;
+    ccOptions.initCwnd = opts.initCwnd;
+    return make_unique<CubicCongestionControl>(ccOptions);
+  };
+
+  shared_ptr<SegmentFetcher> fetcher = SegmentFetcher::start(face, Interest("/hello/world"),
+                                                             acceptValidator, options);
+  face.onSendInterest.connect(bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+  BOOST_CHECK_EQUAL(nCreated, 1);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 4.0);
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(dataSize, 14 * 401);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 401);
+  BOOST_CHECK_EQUAL(nAfterSegmentNacked, 2);
+  BOOST_CHECK_EQUAL(nCreated, 1);
+}
+
 BOOST_AUTO_TEST_CASE(OtherNackReason)
 {
   DummyValidator acceptValidator;
@@ -851,6 +944,159 @@ BOOST_AUTO_TEST_CASE(UncanceledPendingInterestBug) // Bug #4770
   BOOST_CHECK_EQUAL(nCompletions, 1);
 }
 
+class FileModeFixture : public SegmentFetcherFixture
+{
+protected:
+  FileModeFixture()
+    : filepath(boost::filesystem::path(UNIT_TESTS_TMPDIR) / "TestSegmentFetcher")
+  {
+    boost::filesystem::create_directories(filepath.parent_path());
+    fd = ::open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    BOOST_REQUIRE(fd >= 0);
+    options.outputFd = fd;
+  }
+
+  ~FileModeFixture() override
+  {
+    ::close(fd);
+    boost::system::error_code ec;
+    boost::filesystem::remove(filepath, ec); // ignore error
+  }
+
+  std::string
+  readFile() const
+  {
+    std::ifstream fs(filepath.string(), std::ios_base::binary);
+    return std::string(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+  }
+
+  static shared_ptr<Data>
+  makeSegment(uint64_t segment, const std::string& content, bool isFinal)
+  {
+    auto data = makeDataSegment("/hello/world/version0", segment, isFinal);
+    data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+    return data;
+  }
+
+protected:
+  const boost::filesystem::path filepath;
+  int fd = -1;
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FileMode, FileModeFixture)
+
+BOOST_AUTO_TEST_CASE(MultipleSegments)
+{
+  nSegments = 401;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+  size_t nFileCompletions = 0;
+  fetcher->onFileComplete.connect([&] { ++nFileCompletions; });
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 0);
+  BOOST_CHECK_EQUAL(nFileCompletions, 1);
+  BOOST_CHECK_EQUAL(fetcher->getNContiguousSegments(), 401);
+  BOOST_CHECK_EQUAL(fetcher->getContiguousOffset(), 14 * 401);
+
+  std::string expected;
+  for (int i = 0; i < 401; ++i) {
+    expected.append("Hello, world!", 14);
+  }
+  BOOST_CHECK(readFile() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(OutOfOrder)
+{
+  options.initCwnd = 4.0;
+  options.useConstantCwnd = true;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  connectSignals(fetcher);
+  size_t nFileCompletions = 0;
+  fetcher->onFileComplete.connect([&] { ++nFileCompletions; });
+  advanceClocks(10_ms);
+
+  // the size of the segments is not known until a segment other than the last is received
+  face.receive(*makeSegment(3, "dd", true));
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(readFile(), "");
+  face.receive(*makeSegment(2, "cccc", false));
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(fetcher->getNContiguousSegments(), 0);
+  BOOST_CHECK_EQUAL(fetcher->getContiguousOffset(), 0);
+
+  face.receive(*makeSegment(0, "aaaa", false));
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(fetcher->getNContiguousSegments(), 1);
+  BOOST_CHECK_EQUAL(fetcher->getContiguousOffset(), 4);
+  BOOST_CHECK_EQUAL(nFileCompletions, 0);
+
+  face.receive(*makeSegment(1, "bbbb", false));
+  advanceClocks(10_ms);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nFileCompletions, 1);
+  BOOST_CHECK_EQUAL(fetcher->getNContiguousSegments(), 4);
+  BOOST_CHECK_EQUAL(fetcher->getContiguousOffset(), 14);
+  BOOST_CHECK_EQUAL(readFile(), "aaaabbbbccccdd");
+}
+
+BOOST_AUTO_TEST_CASE(Resume)
+{
+  BOOST_REQUIRE_EQUAL(::pwrite(fd, "aaaabbbb", 8, 0), 8);
+
+  options.resumeSegment = 2;
+  options.useConstantCwnd = true;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  connectSignals(fetcher);
+  size_t nFileCompletions = 0;
+  fetcher->onFileComplete.connect([&] { ++nFileCompletions; });
+  advanceClocks(10_ms);
+
+  face.receive(*makeSegment(0, "aaaa", false));
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName(),
+                    Name("/hello/world/version0").appendSegment(2));
+
+  face.receive(*makeSegment(2, "cccc", false));
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 3);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName(),
+                    Name("/hello/world/version0").appendSegment(3));
+  face.receive(*makeSegment(3, "d", true));
+  advanceClocks(10_ms);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nFileCompletions, 1);
+  BOOST_CHECK_EQUAL(fetcher->getNContiguousSegments(), 4);
+  BOOST_CHECK_EQUAL(readFile(), "aaaabbbbccccd");
+}
+
+BOOST_AUTO_TEST_CASE(SizeMismatch)
+{
+  options.initCwnd = 2.0;
+  options.useConstantCwnd = true;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  connectSignals(fetcher);
+  advanceClocks(10_ms);
+
+  face.receive(*makeSegment(0, "aaaa", false));
+  advanceClocks(10_ms);
+  face.receive(*makeSegment(1, "bbb", false));
+  advanceClocks(10_ms);
+
+  BOOST_CHECK_EQUAL(nErrors, 1);
+  BOOST_CHECK_EQUAL(lastError, static_cast<uint32_t>(SegmentFetcher::SEGMENT_SIZE_MISMATCH));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FileMode
+
 BOOST_AUTO_TEST_SUITE_END() // TestSegmentFetcher
 BOOST_AUTO_TEST_SUITE_END() // Util
 